@@ -0,0 +1,2 @@
+const char *build_hash = "3b6499d6977a1dfccb6aea66a678fe4c375d382a";
+const char *build_version = "1.0.0-dev";
@@ -0,0 +1,126 @@
+// Generated by rle-genops from https://github.com/eloj/rle-zoo
+
+// Codec for RLE8 variant 'icns'
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stddef.h>
+#if defined(_MSC_VER)
+#include <BaseTsd.h>
+typedef SSIZE_T ssize_t;
+#else
+#include <sys/types.h> // ssize_t
+#endif
+
+ssize_t icns_gen_compress(const uint8_t *src, size_t slen, uint8_t *dest, size_t dlen);
+ssize_t icns_gen_decompress(const uint8_t *src, size_t slen, uint8_t *dest, size_t dlen);
+
+#if defined(RLE_ZOO_GEN_ICNS_IMPLEMENTATION) || defined(RLE_ZOO_IMPLEMENTATION)
+#include <assert.h>
+#include <string.h>
+
+static_assert(sizeof(size_t) == sizeof(ssize_t), "");
+
+// return -(rp + 1) ... mask so it can't flip positive.
+#define RLE_ZOO_RETURN_ERR return ~(rp & ((size_t)~0 >> 1UL))
+
+// RLE PARAMS: min CPY=1, max CPY=128, min REP=3, max REP=130
+ssize_t icns_gen_compress(const uint8_t *src, size_t slen, uint8_t *dest, size_t dlen) {
+	size_t rp = 0;
+	size_t wp = 0;
+
+	while (rp < slen) {
+		size_t cnt = 1;
+		while (rp + cnt < slen && cnt < 130 && src[rp + cnt] == src[rp]) {
+			++cnt;
+		}
+
+		// REP
+		if (cnt >= 3) {
+			if (dest) {
+				if (2 > dlen - wp) {
+					RLE_ZOO_RETURN_ERR;
+				}
+				dest[wp + 0] = (uint8_t)(0x7D + cnt);
+				dest[wp + 1] = src[rp];
+			}
+			wp += 2;
+			rp += cnt;
+			continue;
+		}
+
+		// CPY
+		size_t same = 0;
+		cnt = 1;
+		while (rp + cnt < slen && cnt < 128) {
+			if (src[rp + cnt - 1] != src[rp + cnt]) {
+				same = 0;
+			} else if (++same == 2) {
+				cnt -= 2;
+				break;
+			}
+			++cnt;
+		}
+		assert(cnt > 0 && rp + cnt <= slen);
+		if (dest) {
+			if (cnt + 1 > dlen - wp) {
+				RLE_ZOO_RETURN_ERR;
+			}
+			dest[wp] = (uint8_t)(cnt - 1);
+			memcpy(dest + wp + 1, src + rp, cnt);
+		}
+		wp += cnt + 1;
+		rp += cnt;
+	}
+	assert(rp == slen);
+	assert((dest == NULL) || (wp <= dlen));
+	return (ssize_t)wp;
+}
+
+ssize_t icns_gen_decompress(const uint8_t *src, size_t slen, uint8_t *dest, size_t dlen) {
+	size_t wp = 0;
+	size_t rp = 0;
+	while (rp < slen) {
+		size_t cnt;
+		uint8_t b = src[rp++];
+		if (b <= 0x7F) {
+			// CPY
+			cnt = (size_t)b + 1;
+			if (cnt > slen - rp) {
+				RLE_ZOO_RETURN_ERR;
+			}
+			if (dest) {
+				if (cnt > dlen - wp) {
+					RLE_ZOO_RETURN_ERR;
+				}
+				memcpy(dest + wp, src + rp, cnt);
+			}
+			rp += cnt;
+		} else {
+			// REP
+			cnt = (size_t)b - 125;
+			if (!(rp < slen)) {
+				RLE_ZOO_RETURN_ERR;
+			}
+			if (dest) {
+				if (cnt > dlen - wp) {
+					RLE_ZOO_RETURN_ERR;
+				}
+				memset(dest + wp, src[rp], cnt);
+			}
+			++rp;
+		}
+		wp += cnt;
+	}
+	assert(rp == slen);
+	assert((dest == NULL) || (wp <= dlen));
+	return (ssize_t)wp;
+}
+#undef RLE_ZOO_RETURN_ERR
+#endif
+
+#ifdef __cplusplus
+}
+#endif
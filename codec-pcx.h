@@ -0,0 +1,109 @@
+// Generated by rle-genops from https://github.com/eloj/rle-zoo
+
+// Codec for RLE8 variant 'pcx'
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stddef.h>
+#if defined(_MSC_VER)
+#include <BaseTsd.h>
+typedef SSIZE_T ssize_t;
+#else
+#include <sys/types.h> // ssize_t
+#endif
+
+ssize_t pcx_gen_compress(const uint8_t *src, size_t slen, uint8_t *dest, size_t dlen);
+ssize_t pcx_gen_decompress(const uint8_t *src, size_t slen, uint8_t *dest, size_t dlen);
+
+#if defined(RLE_ZOO_GEN_PCX_IMPLEMENTATION) || defined(RLE_ZOO_IMPLEMENTATION)
+#include <assert.h>
+#include <string.h>
+
+static_assert(sizeof(size_t) == sizeof(ssize_t), "");
+
+// return -(rp + 1) ... mask so it can't flip positive.
+#define RLE_ZOO_RETURN_ERR return ~(rp & ((size_t)~0 >> 1UL))
+
+// RLE PARAMS: LIT=0x00-0xBF, min REP=0, max REP=63
+ssize_t pcx_gen_compress(const uint8_t *src, size_t slen, uint8_t *dest, size_t dlen) {
+	size_t rp = 0;
+	size_t wp = 0;
+
+	while (rp < slen) {
+		size_t cnt = 1;
+		while (rp + cnt < slen && cnt < 63 && src[rp + cnt] == src[rp]) {
+			++cnt;
+		}
+
+		// REP
+		if (cnt >= 2 || src[rp] > 0xBF) {
+			if (dest) {
+				if (2 > dlen - wp) {
+					RLE_ZOO_RETURN_ERR;
+				}
+				dest[wp + 0] = (uint8_t)(0xC0 + cnt);
+				dest[wp + 1] = src[rp];
+			}
+			wp += 2;
+			rp += cnt;
+			continue;
+		}
+
+		// LIT
+		if (dest) {
+			if (!(wp < dlen)) {
+				RLE_ZOO_RETURN_ERR;
+			}
+			dest[wp] = src[rp];
+		}
+		++wp;
+		++rp;
+	}
+	assert(rp == slen);
+	assert((dest == NULL) || (wp <= dlen));
+	return (ssize_t)wp;
+}
+
+ssize_t pcx_gen_decompress(const uint8_t *src, size_t slen, uint8_t *dest, size_t dlen) {
+	size_t wp = 0;
+	size_t rp = 0;
+	while (rp < slen) {
+		size_t cnt;
+		uint8_t b = src[rp++];
+		if (b <= 0xBF) {
+			// LIT
+			cnt = 1;
+			if (dest) {
+				if (!(wp < dlen)) {
+					RLE_ZOO_RETURN_ERR;
+				}
+				dest[wp] = b;
+			}
+		} else {
+			// REP
+			cnt = (size_t)b - 192;
+			if (!(rp < slen)) {
+				RLE_ZOO_RETURN_ERR;
+			}
+			if (dest) {
+				if (cnt > dlen - wp) {
+					RLE_ZOO_RETURN_ERR;
+				}
+				memset(dest + wp, src[rp], cnt);
+			}
+			++rp;
+		}
+		wp += cnt;
+	}
+	assert(rp == slen);
+	assert((dest == NULL) || (wp <= dlen));
+	return (ssize_t)wp;
+}
+#undef RLE_ZOO_RETURN_ERR
+#endif
+
+#ifdef __cplusplus
+}
+#endif
@@ -11,6 +11,18 @@
 #include "rle_packbits.h"
 #include "rle_pcx.h"
 #include "rle_icns.h"
+#include "rle_tga.h"
+#include "rle_bmp.h"
+#include "rle_bitrun.h"
+#include "rle_nibble.h"
+#include "rle_pict.h"
+#include "rle_exepack.h"
+#include "rle_pcx_image.h"
+#include "rle_icns_image.h"
+#include "rle_ilbm_image.h"
+#include "rle_tiff_image.h"
+#include "rle_goldbox_dax.h"
+#include "rle_psd_image.h"
 
 /* this lets the source compile without afl-clang-fast/lto */
 #ifndef __AFL_FUZZ_TESTCASE_LEN
@@ -53,12 +65,76 @@ int main(void) {
 
 		resc += packbits_compress(input, len, dest, sizeof(dest));
 		resd += packbits_decompress(input, len, dest, sizeof(dest));
+		resd += packbits_decompress_xor(input, len, dest, sizeof(dest));
 
 		resc += pcx_compress(input, len, dest, sizeof(dest));
 		resd += pcx_decompress(input, len, dest, sizeof(dest));
 
 		resc += icns_compress(input, len, dest, sizeof(dest));
 		resd += icns_decompress(input, len, dest, sizeof(dest));
+		resd += icns_decompress_xor(input, len, dest, sizeof(dest));
+
+		resc += tga24_compress(input, len, dest, sizeof(dest));
+		resd += tga24_decompress(input, len, dest, sizeof(dest));
+		resd += tga_decompress_image(input, len, dest, 48, 16, 16, 3);
+
+		resc += bmp_rle8_compress(input, len, dest, sizeof(dest));
+		resd += bmp_rle8_decompress(input, len, dest, sizeof(dest));
+		resd += bmp_rle8_decompress_image(input, len, dest, 32, 32, 32);
+		resd += bmp_rle4_decompress_image(input, len, dest, 32, 64, 32);
+
+		resc += bitrun_compress(input, len, dest, sizeof(dest));
+		resd += bitrun_decompress(input, len, dest, sizeof(dest));
+
+		resc += nibble_packbits_compress(input, len, dest, sizeof(dest));
+		resd += nibble_packbits_decompress(input, len, dest, sizeof(dest));
+		resc += nibble_bmp_rle4_compress(input, len, dest, sizeof(dest));
+		resd += nibble_bmp_rle4_decompress(input, len, dest, sizeof(dest));
+
+		resc += pict16_compress(input, len, dest, sizeof(dest));
+		resd += pict16_decompress(input, len, dest, sizeof(dest));
+
+		resc += exepack_compress(input, len, dest, sizeof(dest));
+		resd += exepack_decompress(input, len, dest, sizeof(dest));
+		if (len <= sizeof(dest)) {
+			memcpy(dest, input, len);
+			resd += exepack_decompress_inplace(dest, len, sizeof(dest));
+		}
+		resd += pict_decompress_image(input, len, dest, 32, 32, 32, 2);
+
+		struct pcx_image pcx;
+		if (pcx_image_parse(input, len, &pcx) == 0 && pcx.height * pcx_image_rowlen(&pcx, PCX_FORMAT_RAW) <= sizeof(dest)) {
+			resd += pcx_image_decode(&pcx, input, len, PCX_FORMAT_RAW, dest, (ptrdiff_t)pcx_image_rowlen(&pcx, PCX_FORMAT_RAW));
+		}
+
+		struct icns_icon icons[4];
+		int nicons = icns_parse(input, len, icons, 4);
+		for (int i = 0 ; i < nicons && i < 4 ; ++i) {
+			if (4 * icons[i].width * icons[i].width <= sizeof(dest))
+				resd += icns_decode_rgba(&icons[i], dest, (ptrdiff_t)(4 * icons[i].width));
+		}
+
+		struct ilbm_image ilbm;
+		if (ilbm_image_parse(input, len, &ilbm) == 0 && ilbm.width * ilbm.height <= sizeof(dest)) {
+			resd += ilbm_image_decode(&ilbm, dest, (ptrdiff_t)ilbm.width);
+		}
+
+		struct tiff_image tiff;
+		if (tiff_image_parse(input, len, &tiff) == 0 && tiff.height * tiff_image_rowlen(&tiff) <= sizeof(dest)) {
+			resd += tiff_image_decode(&tiff, input, len, dest, (ptrdiff_t)tiff_image_rowlen(&tiff));
+		}
+
+		struct dax_archive dax;
+		if (dax_parse(&dax, input, len) == 0) {
+			for (size_t i = 0 ; i < dax.nrecords ; ++i)
+				resd += dax_extract(&dax, i, dest, sizeof(dest));
+			dax_close(&dax);
+		}
+
+		struct psd_image psd;
+		if (psd_image_parse(input, len, &psd) == 0 && psd.height * psd_image_rowlen(&psd, PSD_FORMAT_RGBA) <= sizeof(dest)) {
+			resd += psd_image_decode(&psd, input, len, PSD_FORMAT_RGBA, dest, (ptrdiff_t)psd_image_rowlen(&psd, PSD_FORMAT_RGBA));
+		}
 	}
 	printf("resc=%zd, resd=%zd\n", resc, resd);
 	return 0;
@@ -0,0 +1,461 @@
+// Generated by rle-genops from https://github.com/eloj/rle-zoo
+
+// Decode table for RLE8 variant 'icns'
+static struct rle8 rle8_tbl_decode_icns[256] = {
+ /* 00 */ { RLE_OP_CPY,   1 }, /* 01 */ { RLE_OP_CPY,   2 }, /* 02 */ { RLE_OP_CPY,   3 }, /* 03 */ { RLE_OP_CPY,   4 },
+ /* 04 */ { RLE_OP_CPY,   5 }, /* 05 */ { RLE_OP_CPY,   6 }, /* 06 */ { RLE_OP_CPY,   7 }, /* 07 */ { RLE_OP_CPY,   8 },
+ /* 08 */ { RLE_OP_CPY,   9 }, /* 09 */ { RLE_OP_CPY,  10 }, /* 0A */ { RLE_OP_CPY,  11 }, /* 0B */ { RLE_OP_CPY,  12 },
+ /* 0C */ { RLE_OP_CPY,  13 }, /* 0D */ { RLE_OP_CPY,  14 }, /* 0E */ { RLE_OP_CPY,  15 }, /* 0F */ { RLE_OP_CPY,  16 },
+ /* 10 */ { RLE_OP_CPY,  17 }, /* 11 */ { RLE_OP_CPY,  18 }, /* 12 */ { RLE_OP_CPY,  19 }, /* 13 */ { RLE_OP_CPY,  20 },
+ /* 14 */ { RLE_OP_CPY,  21 }, /* 15 */ { RLE_OP_CPY,  22 }, /* 16 */ { RLE_OP_CPY,  23 }, /* 17 */ { RLE_OP_CPY,  24 },
+ /* 18 */ { RLE_OP_CPY,  25 }, /* 19 */ { RLE_OP_CPY,  26 }, /* 1A */ { RLE_OP_CPY,  27 }, /* 1B */ { RLE_OP_CPY,  28 },
+ /* 1C */ { RLE_OP_CPY,  29 }, /* 1D */ { RLE_OP_CPY,  30 }, /* 1E */ { RLE_OP_CPY,  31 }, /* 1F */ { RLE_OP_CPY,  32 },
+ /* 20 */ { RLE_OP_CPY,  33 }, /* 21 */ { RLE_OP_CPY,  34 }, /* 22 */ { RLE_OP_CPY,  35 }, /* 23 */ { RLE_OP_CPY,  36 },
+ /* 24 */ { RLE_OP_CPY,  37 }, /* 25 */ { RLE_OP_CPY,  38 }, /* 26 */ { RLE_OP_CPY,  39 }, /* 27 */ { RLE_OP_CPY,  40 },
+ /* 28 */ { RLE_OP_CPY,  41 }, /* 29 */ { RLE_OP_CPY,  42 }, /* 2A */ { RLE_OP_CPY,  43 }, /* 2B */ { RLE_OP_CPY,  44 },
+ /* 2C */ { RLE_OP_CPY,  45 }, /* 2D */ { RLE_OP_CPY,  46 }, /* 2E */ { RLE_OP_CPY,  47 }, /* 2F */ { RLE_OP_CPY,  48 },
+ /* 30 */ { RLE_OP_CPY,  49 }, /* 31 */ { RLE_OP_CPY,  50 }, /* 32 */ { RLE_OP_CPY,  51 }, /* 33 */ { RLE_OP_CPY,  52 },
+ /* 34 */ { RLE_OP_CPY,  53 }, /* 35 */ { RLE_OP_CPY,  54 }, /* 36 */ { RLE_OP_CPY,  55 }, /* 37 */ { RLE_OP_CPY,  56 },
+ /* 38 */ { RLE_OP_CPY,  57 }, /* 39 */ { RLE_OP_CPY,  58 }, /* 3A */ { RLE_OP_CPY,  59 }, /* 3B */ { RLE_OP_CPY,  60 },
+ /* 3C */ { RLE_OP_CPY,  61 }, /* 3D */ { RLE_OP_CPY,  62 }, /* 3E */ { RLE_OP_CPY,  63 }, /* 3F */ { RLE_OP_CPY,  64 },
+ /* 40 */ { RLE_OP_CPY,  65 }, /* 41 */ { RLE_OP_CPY,  66 }, /* 42 */ { RLE_OP_CPY,  67 }, /* 43 */ { RLE_OP_CPY,  68 },
+ /* 44 */ { RLE_OP_CPY,  69 }, /* 45 */ { RLE_OP_CPY,  70 }, /* 46 */ { RLE_OP_CPY,  71 }, /* 47 */ { RLE_OP_CPY,  72 },
+ /* 48 */ { RLE_OP_CPY,  73 }, /* 49 */ { RLE_OP_CPY,  74 }, /* 4A */ { RLE_OP_CPY,  75 }, /* 4B */ { RLE_OP_CPY,  76 },
+ /* 4C */ { RLE_OP_CPY,  77 }, /* 4D */ { RLE_OP_CPY,  78 }, /* 4E */ { RLE_OP_CPY,  79 }, /* 4F */ { RLE_OP_CPY,  80 },
+ /* 50 */ { RLE_OP_CPY,  81 }, /* 51 */ { RLE_OP_CPY,  82 }, /* 52 */ { RLE_OP_CPY,  83 }, /* 53 */ { RLE_OP_CPY,  84 },
+ /* 54 */ { RLE_OP_CPY,  85 }, /* 55 */ { RLE_OP_CPY,  86 }, /* 56 */ { RLE_OP_CPY,  87 }, /* 57 */ { RLE_OP_CPY,  88 },
+ /* 58 */ { RLE_OP_CPY,  89 }, /* 59 */ { RLE_OP_CPY,  90 }, /* 5A */ { RLE_OP_CPY,  91 }, /* 5B */ { RLE_OP_CPY,  92 },
+ /* 5C */ { RLE_OP_CPY,  93 }, /* 5D */ { RLE_OP_CPY,  94 }, /* 5E */ { RLE_OP_CPY,  95 }, /* 5F */ { RLE_OP_CPY,  96 },
+ /* 60 */ { RLE_OP_CPY,  97 }, /* 61 */ { RLE_OP_CPY,  98 }, /* 62 */ { RLE_OP_CPY,  99 }, /* 63 */ { RLE_OP_CPY, 100 },
+ /* 64 */ { RLE_OP_CPY, 101 }, /* 65 */ { RLE_OP_CPY, 102 }, /* 66 */ { RLE_OP_CPY, 103 }, /* 67 */ { RLE_OP_CPY, 104 },
+ /* 68 */ { RLE_OP_CPY, 105 }, /* 69 */ { RLE_OP_CPY, 106 }, /* 6A */ { RLE_OP_CPY, 107 }, /* 6B */ { RLE_OP_CPY, 108 },
+ /* 6C */ { RLE_OP_CPY, 109 }, /* 6D */ { RLE_OP_CPY, 110 }, /* 6E */ { RLE_OP_CPY, 111 }, /* 6F */ { RLE_OP_CPY, 112 },
+ /* 70 */ { RLE_OP_CPY, 113 }, /* 71 */ { RLE_OP_CPY, 114 }, /* 72 */ { RLE_OP_CPY, 115 }, /* 73 */ { RLE_OP_CPY, 116 },
+ /* 74 */ { RLE_OP_CPY, 117 }, /* 75 */ { RLE_OP_CPY, 118 }, /* 76 */ { RLE_OP_CPY, 119 }, /* 77 */ { RLE_OP_CPY, 120 },
+ /* 78 */ { RLE_OP_CPY, 121 }, /* 79 */ { RLE_OP_CPY, 122 }, /* 7A */ { RLE_OP_CPY, 123 }, /* 7B */ { RLE_OP_CPY, 124 },
+ /* 7C */ { RLE_OP_CPY, 125 }, /* 7D */ { RLE_OP_CPY, 126 }, /* 7E */ { RLE_OP_CPY, 127 }, /* 7F */ { RLE_OP_CPY, 128 },
+ /* 80 */ { RLE_OP_REP,   3 }, /* 81 */ { RLE_OP_REP,   4 }, /* 82 */ { RLE_OP_REP,   5 }, /* 83 */ { RLE_OP_REP,   6 },
+ /* 84 */ { RLE_OP_REP,   7 }, /* 85 */ { RLE_OP_REP,   8 }, /* 86 */ { RLE_OP_REP,   9 }, /* 87 */ { RLE_OP_REP,  10 },
+ /* 88 */ { RLE_OP_REP,  11 }, /* 89 */ { RLE_OP_REP,  12 }, /* 8A */ { RLE_OP_REP,  13 }, /* 8B */ { RLE_OP_REP,  14 },
+ /* 8C */ { RLE_OP_REP,  15 }, /* 8D */ { RLE_OP_REP,  16 }, /* 8E */ { RLE_OP_REP,  17 }, /* 8F */ { RLE_OP_REP,  18 },
+ /* 90 */ { RLE_OP_REP,  19 }, /* 91 */ { RLE_OP_REP,  20 }, /* 92 */ { RLE_OP_REP,  21 }, /* 93 */ { RLE_OP_REP,  22 },
+ /* 94 */ { RLE_OP_REP,  23 }, /* 95 */ { RLE_OP_REP,  24 }, /* 96 */ { RLE_OP_REP,  25 }, /* 97 */ { RLE_OP_REP,  26 },
+ /* 98 */ { RLE_OP_REP,  27 }, /* 99 */ { RLE_OP_REP,  28 }, /* 9A */ { RLE_OP_REP,  29 }, /* 9B */ { RLE_OP_REP,  30 },
+ /* 9C */ { RLE_OP_REP,  31 }, /* 9D */ { RLE_OP_REP,  32 }, /* 9E */ { RLE_OP_REP,  33 }, /* 9F */ { RLE_OP_REP,  34 },
+ /* A0 */ { RLE_OP_REP,  35 }, /* A1 */ { RLE_OP_REP,  36 }, /* A2 */ { RLE_OP_REP,  37 }, /* A3 */ { RLE_OP_REP,  38 },
+ /* A4 */ { RLE_OP_REP,  39 }, /* A5 */ { RLE_OP_REP,  40 }, /* A6 */ { RLE_OP_REP,  41 }, /* A7 */ { RLE_OP_REP,  42 },
+ /* A8 */ { RLE_OP_REP,  43 }, /* A9 */ { RLE_OP_REP,  44 }, /* AA */ { RLE_OP_REP,  45 }, /* AB */ { RLE_OP_REP,  46 },
+ /* AC */ { RLE_OP_REP,  47 }, /* AD */ { RLE_OP_REP,  48 }, /* AE */ { RLE_OP_REP,  49 }, /* AF */ { RLE_OP_REP,  50 },
+ /* B0 */ { RLE_OP_REP,  51 }, /* B1 */ { RLE_OP_REP,  52 }, /* B2 */ { RLE_OP_REP,  53 }, /* B3 */ { RLE_OP_REP,  54 },
+ /* B4 */ { RLE_OP_REP,  55 }, /* B5 */ { RLE_OP_REP,  56 }, /* B6 */ { RLE_OP_REP,  57 }, /* B7 */ { RLE_OP_REP,  58 },
+ /* B8 */ { RLE_OP_REP,  59 }, /* B9 */ { RLE_OP_REP,  60 }, /* BA */ { RLE_OP_REP,  61 }, /* BB */ { RLE_OP_REP,  62 },
+ /* BC */ { RLE_OP_REP,  63 }, /* BD */ { RLE_OP_REP,  64 }, /* BE */ { RLE_OP_REP,  65 }, /* BF */ { RLE_OP_REP,  66 },
+ /* C0 */ { RLE_OP_REP,  67 }, /* C1 */ { RLE_OP_REP,  68 }, /* C2 */ { RLE_OP_REP,  69 }, /* C3 */ { RLE_OP_REP,  70 },
+ /* C4 */ { RLE_OP_REP,  71 }, /* C5 */ { RLE_OP_REP,  72 }, /* C6 */ { RLE_OP_REP,  73 }, /* C7 */ { RLE_OP_REP,  74 },
+ /* C8 */ { RLE_OP_REP,  75 }, /* C9 */ { RLE_OP_REP,  76 }, /* CA */ { RLE_OP_REP,  77 }, /* CB */ { RLE_OP_REP,  78 },
+ /* CC */ { RLE_OP_REP,  79 }, /* CD */ { RLE_OP_REP,  80 }, /* CE */ { RLE_OP_REP,  81 }, /* CF */ { RLE_OP_REP,  82 },
+ /* D0 */ { RLE_OP_REP,  83 }, /* D1 */ { RLE_OP_REP,  84 }, /* D2 */ { RLE_OP_REP,  85 }, /* D3 */ { RLE_OP_REP,  86 },
+ /* D4 */ { RLE_OP_REP,  87 }, /* D5 */ { RLE_OP_REP,  88 }, /* D6 */ { RLE_OP_REP,  89 }, /* D7 */ { RLE_OP_REP,  90 },
+ /* D8 */ { RLE_OP_REP,  91 }, /* D9 */ { RLE_OP_REP,  92 }, /* DA */ { RLE_OP_REP,  93 }, /* DB */ { RLE_OP_REP,  94 },
+ /* DC */ { RLE_OP_REP,  95 }, /* DD */ { RLE_OP_REP,  96 }, /* DE */ { RLE_OP_REP,  97 }, /* DF */ { RLE_OP_REP,  98 },
+ /* E0 */ { RLE_OP_REP,  99 }, /* E1 */ { RLE_OP_REP, 100 }, /* E2 */ { RLE_OP_REP, 101 }, /* E3 */ { RLE_OP_REP, 102 },
+ /* E4 */ { RLE_OP_REP, 103 }, /* E5 */ { RLE_OP_REP, 104 }, /* E6 */ { RLE_OP_REP, 105 }, /* E7 */ { RLE_OP_REP, 106 },
+ /* E8 */ { RLE_OP_REP, 107 }, /* E9 */ { RLE_OP_REP, 108 }, /* EA */ { RLE_OP_REP, 109 }, /* EB */ { RLE_OP_REP, 110 },
+ /* EC */ { RLE_OP_REP, 111 }, /* ED */ { RLE_OP_REP, 112 }, /* EE */ { RLE_OP_REP, 113 }, /* EF */ { RLE_OP_REP, 114 },
+ /* F0 */ { RLE_OP_REP, 115 }, /* F1 */ { RLE_OP_REP, 116 }, /* F2 */ { RLE_OP_REP, 117 }, /* F3 */ { RLE_OP_REP, 118 },
+ /* F4 */ { RLE_OP_REP, 119 }, /* F5 */ { RLE_OP_REP, 120 }, /* F6 */ { RLE_OP_REP, 121 }, /* F7 */ { RLE_OP_REP, 122 },
+ /* F8 */ { RLE_OP_REP, 123 }, /* F9 */ { RLE_OP_REP, 124 }, /* FA */ { RLE_OP_REP, 125 }, /* FB */ { RLE_OP_REP, 126 },
+ /* FC */ { RLE_OP_REP, 127 }, /* FD */ { RLE_OP_REP, 128 }, /* FE */ { RLE_OP_REP, 129 }, /* FF */ { RLE_OP_REP, 130 }
+};
+
+// Step table for RLE8 variant 'icns'
+static struct rle8_step rle8_tbl_step_icns[256] = {
+ /* 00 */ { RLE_OP_CPY, 1, 1,   1,   2 }, /* 01 */ { RLE_OP_CPY, 1, 1,   2,   3 }, /* 02 */ { RLE_OP_CPY, 1, 1,   3,   4 }, /* 03 */ { RLE_OP_CPY, 1, 1,   4,   5 },
+ /* 04 */ { RLE_OP_CPY, 1, 1,   5,   6 }, /* 05 */ { RLE_OP_CPY, 1, 1,   6,   7 }, /* 06 */ { RLE_OP_CPY, 1, 1,   7,   8 }, /* 07 */ { RLE_OP_CPY, 1, 1,   8,   9 },
+ /* 08 */ { RLE_OP_CPY, 1, 1,   9,  10 }, /* 09 */ { RLE_OP_CPY, 1, 1,  10,  11 }, /* 0A */ { RLE_OP_CPY, 1, 1,  11,  12 }, /* 0B */ { RLE_OP_CPY, 1, 1,  12,  13 },
+ /* 0C */ { RLE_OP_CPY, 1, 1,  13,  14 }, /* 0D */ { RLE_OP_CPY, 1, 1,  14,  15 }, /* 0E */ { RLE_OP_CPY, 1, 1,  15,  16 }, /* 0F */ { RLE_OP_CPY, 1, 1,  16,  17 },
+ /* 10 */ { RLE_OP_CPY, 1, 1,  17,  18 }, /* 11 */ { RLE_OP_CPY, 1, 1,  18,  19 }, /* 12 */ { RLE_OP_CPY, 1, 1,  19,  20 }, /* 13 */ { RLE_OP_CPY, 1, 1,  20,  21 },
+ /* 14 */ { RLE_OP_CPY, 1, 1,  21,  22 }, /* 15 */ { RLE_OP_CPY, 1, 1,  22,  23 }, /* 16 */ { RLE_OP_CPY, 1, 1,  23,  24 }, /* 17 */ { RLE_OP_CPY, 1, 1,  24,  25 },
+ /* 18 */ { RLE_OP_CPY, 1, 1,  25,  26 }, /* 19 */ { RLE_OP_CPY, 1, 1,  26,  27 }, /* 1A */ { RLE_OP_CPY, 1, 1,  27,  28 }, /* 1B */ { RLE_OP_CPY, 1, 1,  28,  29 },
+ /* 1C */ { RLE_OP_CPY, 1, 1,  29,  30 }, /* 1D */ { RLE_OP_CPY, 1, 1,  30,  31 }, /* 1E */ { RLE_OP_CPY, 1, 1,  31,  32 }, /* 1F */ { RLE_OP_CPY, 1, 1,  32,  33 },
+ /* 20 */ { RLE_OP_CPY, 1, 1,  33,  34 }, /* 21 */ { RLE_OP_CPY, 1, 1,  34,  35 }, /* 22 */ { RLE_OP_CPY, 1, 1,  35,  36 }, /* 23 */ { RLE_OP_CPY, 1, 1,  36,  37 },
+ /* 24 */ { RLE_OP_CPY, 1, 1,  37,  38 }, /* 25 */ { RLE_OP_CPY, 1, 1,  38,  39 }, /* 26 */ { RLE_OP_CPY, 1, 1,  39,  40 }, /* 27 */ { RLE_OP_CPY, 1, 1,  40,  41 },
+ /* 28 */ { RLE_OP_CPY, 1, 1,  41,  42 }, /* 29 */ { RLE_OP_CPY, 1, 1,  42,  43 }, /* 2A */ { RLE_OP_CPY, 1, 1,  43,  44 }, /* 2B */ { RLE_OP_CPY, 1, 1,  44,  45 },
+ /* 2C */ { RLE_OP_CPY, 1, 1,  45,  46 }, /* 2D */ { RLE_OP_CPY, 1, 1,  46,  47 }, /* 2E */ { RLE_OP_CPY, 1, 1,  47,  48 }, /* 2F */ { RLE_OP_CPY, 1, 1,  48,  49 },
+ /* 30 */ { RLE_OP_CPY, 1, 1,  49,  50 }, /* 31 */ { RLE_OP_CPY, 1, 1,  50,  51 }, /* 32 */ { RLE_OP_CPY, 1, 1,  51,  52 }, /* 33 */ { RLE_OP_CPY, 1, 1,  52,  53 },
+ /* 34 */ { RLE_OP_CPY, 1, 1,  53,  54 }, /* 35 */ { RLE_OP_CPY, 1, 1,  54,  55 }, /* 36 */ { RLE_OP_CPY, 1, 1,  55,  56 }, /* 37 */ { RLE_OP_CPY, 1, 1,  56,  57 },
+ /* 38 */ { RLE_OP_CPY, 1, 1,  57,  58 }, /* 39 */ { RLE_OP_CPY, 1, 1,  58,  59 }, /* 3A */ { RLE_OP_CPY, 1, 1,  59,  60 }, /* 3B */ { RLE_OP_CPY, 1, 1,  60,  61 },
+ /* 3C */ { RLE_OP_CPY, 1, 1,  61,  62 }, /* 3D */ { RLE_OP_CPY, 1, 1,  62,  63 }, /* 3E */ { RLE_OP_CPY, 1, 1,  63,  64 }, /* 3F */ { RLE_OP_CPY, 1, 1,  64,  65 },
+ /* 40 */ { RLE_OP_CPY, 1, 1,  65,  66 }, /* 41 */ { RLE_OP_CPY, 1, 1,  66,  67 }, /* 42 */ { RLE_OP_CPY, 1, 1,  67,  68 }, /* 43 */ { RLE_OP_CPY, 1, 1,  68,  69 },
+ /* 44 */ { RLE_OP_CPY, 1, 1,  69,  70 }, /* 45 */ { RLE_OP_CPY, 1, 1,  70,  71 }, /* 46 */ { RLE_OP_CPY, 1, 1,  71,  72 }, /* 47 */ { RLE_OP_CPY, 1, 1,  72,  73 },
+ /* 48 */ { RLE_OP_CPY, 1, 1,  73,  74 }, /* 49 */ { RLE_OP_CPY, 1, 1,  74,  75 }, /* 4A */ { RLE_OP_CPY, 1, 1,  75,  76 }, /* 4B */ { RLE_OP_CPY, 1, 1,  76,  77 },
+ /* 4C */ { RLE_OP_CPY, 1, 1,  77,  78 }, /* 4D */ { RLE_OP_CPY, 1, 1,  78,  79 }, /* 4E */ { RLE_OP_CPY, 1, 1,  79,  80 }, /* 4F */ { RLE_OP_CPY, 1, 1,  80,  81 },
+ /* 50 */ { RLE_OP_CPY, 1, 1,  81,  82 }, /* 51 */ { RLE_OP_CPY, 1, 1,  82,  83 }, /* 52 */ { RLE_OP_CPY, 1, 1,  83,  84 }, /* 53 */ { RLE_OP_CPY, 1, 1,  84,  85 },
+ /* 54 */ { RLE_OP_CPY, 1, 1,  85,  86 }, /* 55 */ { RLE_OP_CPY, 1, 1,  86,  87 }, /* 56 */ { RLE_OP_CPY, 1, 1,  87,  88 }, /* 57 */ { RLE_OP_CPY, 1, 1,  88,  89 },
+ /* 58 */ { RLE_OP_CPY, 1, 1,  89,  90 }, /* 59 */ { RLE_OP_CPY, 1, 1,  90,  91 }, /* 5A */ { RLE_OP_CPY, 1, 1,  91,  92 }, /* 5B */ { RLE_OP_CPY, 1, 1,  92,  93 },
+ /* 5C */ { RLE_OP_CPY, 1, 1,  93,  94 }, /* 5D */ { RLE_OP_CPY, 1, 1,  94,  95 }, /* 5E */ { RLE_OP_CPY, 1, 1,  95,  96 }, /* 5F */ { RLE_OP_CPY, 1, 1,  96,  97 },
+ /* 60 */ { RLE_OP_CPY, 1, 1,  97,  98 }, /* 61 */ { RLE_OP_CPY, 1, 1,  98,  99 }, /* 62 */ { RLE_OP_CPY, 1, 1,  99, 100 }, /* 63 */ { RLE_OP_CPY, 1, 1, 100, 101 },
+ /* 64 */ { RLE_OP_CPY, 1, 1, 101, 102 }, /* 65 */ { RLE_OP_CPY, 1, 1, 102, 103 }, /* 66 */ { RLE_OP_CPY, 1, 1, 103, 104 }, /* 67 */ { RLE_OP_CPY, 1, 1, 104, 105 },
+ /* 68 */ { RLE_OP_CPY, 1, 1, 105, 106 }, /* 69 */ { RLE_OP_CPY, 1, 1, 106, 107 }, /* 6A */ { RLE_OP_CPY, 1, 1, 107, 108 }, /* 6B */ { RLE_OP_CPY, 1, 1, 108, 109 },
+ /* 6C */ { RLE_OP_CPY, 1, 1, 109, 110 }, /* 6D */ { RLE_OP_CPY, 1, 1, 110, 111 }, /* 6E */ { RLE_OP_CPY, 1, 1, 111, 112 }, /* 6F */ { RLE_OP_CPY, 1, 1, 112, 113 },
+ /* 70 */ { RLE_OP_CPY, 1, 1, 113, 114 }, /* 71 */ { RLE_OP_CPY, 1, 1, 114, 115 }, /* 72 */ { RLE_OP_CPY, 1, 1, 115, 116 }, /* 73 */ { RLE_OP_CPY, 1, 1, 116, 117 },
+ /* 74 */ { RLE_OP_CPY, 1, 1, 117, 118 }, /* 75 */ { RLE_OP_CPY, 1, 1, 118, 119 }, /* 76 */ { RLE_OP_CPY, 1, 1, 119, 120 }, /* 77 */ { RLE_OP_CPY, 1, 1, 120, 121 },
+ /* 78 */ { RLE_OP_CPY, 1, 1, 121, 122 }, /* 79 */ { RLE_OP_CPY, 1, 1, 122, 123 }, /* 7A */ { RLE_OP_CPY, 1, 1, 123, 124 }, /* 7B */ { RLE_OP_CPY, 1, 1, 124, 125 },
+ /* 7C */ { RLE_OP_CPY, 1, 1, 125, 126 }, /* 7D */ { RLE_OP_CPY, 1, 1, 126, 127 }, /* 7E */ { RLE_OP_CPY, 1, 1, 127, 128 }, /* 7F */ { RLE_OP_CPY, 1, 1, 128, 129 },
+ /* 80 */ { RLE_OP_REP, 1, 0,   3,   2 }, /* 81 */ { RLE_OP_REP, 1, 0,   4,   2 }, /* 82 */ { RLE_OP_REP, 1, 0,   5,   2 }, /* 83 */ { RLE_OP_REP, 1, 0,   6,   2 },
+ /* 84 */ { RLE_OP_REP, 1, 0,   7,   2 }, /* 85 */ { RLE_OP_REP, 1, 0,   8,   2 }, /* 86 */ { RLE_OP_REP, 1, 0,   9,   2 }, /* 87 */ { RLE_OP_REP, 1, 0,  10,   2 },
+ /* 88 */ { RLE_OP_REP, 1, 0,  11,   2 }, /* 89 */ { RLE_OP_REP, 1, 0,  12,   2 }, /* 8A */ { RLE_OP_REP, 1, 0,  13,   2 }, /* 8B */ { RLE_OP_REP, 1, 0,  14,   2 },
+ /* 8C */ { RLE_OP_REP, 1, 0,  15,   2 }, /* 8D */ { RLE_OP_REP, 1, 0,  16,   2 }, /* 8E */ { RLE_OP_REP, 1, 0,  17,   2 }, /* 8F */ { RLE_OP_REP, 1, 0,  18,   2 },
+ /* 90 */ { RLE_OP_REP, 1, 0,  19,   2 }, /* 91 */ { RLE_OP_REP, 1, 0,  20,   2 }, /* 92 */ { RLE_OP_REP, 1, 0,  21,   2 }, /* 93 */ { RLE_OP_REP, 1, 0,  22,   2 },
+ /* 94 */ { RLE_OP_REP, 1, 0,  23,   2 }, /* 95 */ { RLE_OP_REP, 1, 0,  24,   2 }, /* 96 */ { RLE_OP_REP, 1, 0,  25,   2 }, /* 97 */ { RLE_OP_REP, 1, 0,  26,   2 },
+ /* 98 */ { RLE_OP_REP, 1, 0,  27,   2 }, /* 99 */ { RLE_OP_REP, 1, 0,  28,   2 }, /* 9A */ { RLE_OP_REP, 1, 0,  29,   2 }, /* 9B */ { RLE_OP_REP, 1, 0,  30,   2 },
+ /* 9C */ { RLE_OP_REP, 1, 0,  31,   2 }, /* 9D */ { RLE_OP_REP, 1, 0,  32,   2 }, /* 9E */ { RLE_OP_REP, 1, 0,  33,   2 }, /* 9F */ { RLE_OP_REP, 1, 0,  34,   2 },
+ /* A0 */ { RLE_OP_REP, 1, 0,  35,   2 }, /* A1 */ { RLE_OP_REP, 1, 0,  36,   2 }, /* A2 */ { RLE_OP_REP, 1, 0,  37,   2 }, /* A3 */ { RLE_OP_REP, 1, 0,  38,   2 },
+ /* A4 */ { RLE_OP_REP, 1, 0,  39,   2 }, /* A5 */ { RLE_OP_REP, 1, 0,  40,   2 }, /* A6 */ { RLE_OP_REP, 1, 0,  41,   2 }, /* A7 */ { RLE_OP_REP, 1, 0,  42,   2 },
+ /* A8 */ { RLE_OP_REP, 1, 0,  43,   2 }, /* A9 */ { RLE_OP_REP, 1, 0,  44,   2 }, /* AA */ { RLE_OP_REP, 1, 0,  45,   2 }, /* AB */ { RLE_OP_REP, 1, 0,  46,   2 },
+ /* AC */ { RLE_OP_REP, 1, 0,  47,   2 }, /* AD */ { RLE_OP_REP, 1, 0,  48,   2 }, /* AE */ { RLE_OP_REP, 1, 0,  49,   2 }, /* AF */ { RLE_OP_REP, 1, 0,  50,   2 },
+ /* B0 */ { RLE_OP_REP, 1, 0,  51,   2 }, /* B1 */ { RLE_OP_REP, 1, 0,  52,   2 }, /* B2 */ { RLE_OP_REP, 1, 0,  53,   2 }, /* B3 */ { RLE_OP_REP, 1, 0,  54,   2 },
+ /* B4 */ { RLE_OP_REP, 1, 0,  55,   2 }, /* B5 */ { RLE_OP_REP, 1, 0,  56,   2 }, /* B6 */ { RLE_OP_REP, 1, 0,  57,   2 }, /* B7 */ { RLE_OP_REP, 1, 0,  58,   2 },
+ /* B8 */ { RLE_OP_REP, 1, 0,  59,   2 }, /* B9 */ { RLE_OP_REP, 1, 0,  60,   2 }, /* BA */ { RLE_OP_REP, 1, 0,  61,   2 }, /* BB */ { RLE_OP_REP, 1, 0,  62,   2 },
+ /* BC */ { RLE_OP_REP, 1, 0,  63,   2 }, /* BD */ { RLE_OP_REP, 1, 0,  64,   2 }, /* BE */ { RLE_OP_REP, 1, 0,  65,   2 }, /* BF */ { RLE_OP_REP, 1, 0,  66,   2 },
+ /* C0 */ { RLE_OP_REP, 1, 0,  67,   2 }, /* C1 */ { RLE_OP_REP, 1, 0,  68,   2 }, /* C2 */ { RLE_OP_REP, 1, 0,  69,   2 }, /* C3 */ { RLE_OP_REP, 1, 0,  70,   2 },
+ /* C4 */ { RLE_OP_REP, 1, 0,  71,   2 }, /* C5 */ { RLE_OP_REP, 1, 0,  72,   2 }, /* C6 */ { RLE_OP_REP, 1, 0,  73,   2 }, /* C7 */ { RLE_OP_REP, 1, 0,  74,   2 },
+ /* C8 */ { RLE_OP_REP, 1, 0,  75,   2 }, /* C9 */ { RLE_OP_REP, 1, 0,  76,   2 }, /* CA */ { RLE_OP_REP, 1, 0,  77,   2 }, /* CB */ { RLE_OP_REP, 1, 0,  78,   2 },
+ /* CC */ { RLE_OP_REP, 1, 0,  79,   2 }, /* CD */ { RLE_OP_REP, 1, 0,  80,   2 }, /* CE */ { RLE_OP_REP, 1, 0,  81,   2 }, /* CF */ { RLE_OP_REP, 1, 0,  82,   2 },
+ /* D0 */ { RLE_OP_REP, 1, 0,  83,   2 }, /* D1 */ { RLE_OP_REP, 1, 0,  84,   2 }, /* D2 */ { RLE_OP_REP, 1, 0,  85,   2 }, /* D3 */ { RLE_OP_REP, 1, 0,  86,   2 },
+ /* D4 */ { RLE_OP_REP, 1, 0,  87,   2 }, /* D5 */ { RLE_OP_REP, 1, 0,  88,   2 }, /* D6 */ { RLE_OP_REP, 1, 0,  89,   2 }, /* D7 */ { RLE_OP_REP, 1, 0,  90,   2 },
+ /* D8 */ { RLE_OP_REP, 1, 0,  91,   2 }, /* D9 */ { RLE_OP_REP, 1, 0,  92,   2 }, /* DA */ { RLE_OP_REP, 1, 0,  93,   2 }, /* DB */ { RLE_OP_REP, 1, 0,  94,   2 },
+ /* DC */ { RLE_OP_REP, 1, 0,  95,   2 }, /* DD */ { RLE_OP_REP, 1, 0,  96,   2 }, /* DE */ { RLE_OP_REP, 1, 0,  97,   2 }, /* DF */ { RLE_OP_REP, 1, 0,  98,   2 },
+ /* E0 */ { RLE_OP_REP, 1, 0,  99,   2 }, /* E1 */ { RLE_OP_REP, 1, 0, 100,   2 }, /* E2 */ { RLE_OP_REP, 1, 0, 101,   2 }, /* E3 */ { RLE_OP_REP, 1, 0, 102,   2 },
+ /* E4 */ { RLE_OP_REP, 1, 0, 103,   2 }, /* E5 */ { RLE_OP_REP, 1, 0, 104,   2 }, /* E6 */ { RLE_OP_REP, 1, 0, 105,   2 }, /* E7 */ { RLE_OP_REP, 1, 0, 106,   2 },
+ /* E8 */ { RLE_OP_REP, 1, 0, 107,   2 }, /* E9 */ { RLE_OP_REP, 1, 0, 108,   2 }, /* EA */ { RLE_OP_REP, 1, 0, 109,   2 }, /* EB */ { RLE_OP_REP, 1, 0, 110,   2 },
+ /* EC */ { RLE_OP_REP, 1, 0, 111,   2 }, /* ED */ { RLE_OP_REP, 1, 0, 112,   2 }, /* EE */ { RLE_OP_REP, 1, 0, 113,   2 }, /* EF */ { RLE_OP_REP, 1, 0, 114,   2 },
+ /* F0 */ { RLE_OP_REP, 1, 0, 115,   2 }, /* F1 */ { RLE_OP_REP, 1, 0, 116,   2 }, /* F2 */ { RLE_OP_REP, 1, 0, 117,   2 }, /* F3 */ { RLE_OP_REP, 1, 0, 118,   2 },
+ /* F4 */ { RLE_OP_REP, 1, 0, 119,   2 }, /* F5 */ { RLE_OP_REP, 1, 0, 120,   2 }, /* F6 */ { RLE_OP_REP, 1, 0, 121,   2 }, /* F7 */ { RLE_OP_REP, 1, 0, 122,   2 },
+ /* F8 */ { RLE_OP_REP, 1, 0, 123,   2 }, /* F9 */ { RLE_OP_REP, 1, 0, 124,   2 }, /* FA */ { RLE_OP_REP, 1, 0, 125,   2 }, /* FB */ { RLE_OP_REP, 1, 0, 126,   2 },
+ /* FC */ { RLE_OP_REP, 1, 0, 127,   2 }, /* FD */ { RLE_OP_REP, 1, 0, 128,   2 }, /* FE */ { RLE_OP_REP, 1, 0, 129,   2 }, /* FF */ { RLE_OP_REP, 1, 0, 130,   2 }
+};
+
+// SIMD tables for RLE8 variant 'icns'
+static struct rle8_simd rle8_tbl_simd_icns = {
+	{
+		/* 00 */ { 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 01 */ { 0x01, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 02 */ { 0x01, 0x02, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 03 */ { 0x01, 0x02, 0x03, 0x04, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 04 */ { 0x01, 0x02, 0x03, 0x04, 0x05, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 05 */ { 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 06 */ { 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 07 */ { 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 08 */ { 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 09 */ { 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 0A */ { 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 0B */ { 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x80, 0x80, 0x80, 0x80 },
+		/* 0C */ { 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x80, 0x80, 0x80 },
+		/* 0D */ { 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x80, 0x80 },
+		/* 0E */ { 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x80 },
+		/* 0F */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 10 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 11 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 12 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 13 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 14 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 15 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 16 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 17 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 18 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 19 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 1A */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 1B */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 1C */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 1D */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 1E */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 1F */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 20 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 21 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 22 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 23 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 24 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 25 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 26 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 27 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 28 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 29 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 2A */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 2B */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 2C */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 2D */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 2E */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 2F */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 30 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 31 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 32 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 33 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 34 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 35 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 36 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 37 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 38 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 39 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 3A */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 3B */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 3C */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 3D */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 3E */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 3F */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 40 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 41 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 42 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 43 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 44 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 45 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 46 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 47 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 48 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 49 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 4A */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 4B */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 4C */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 4D */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 4E */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 4F */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 50 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 51 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 52 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 53 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 54 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 55 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 56 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 57 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 58 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 59 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 5A */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 5B */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 5C */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 5D */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 5E */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 5F */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 60 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 61 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 62 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 63 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 64 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 65 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 66 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 67 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 68 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 69 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 6A */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 6B */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 6C */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 6D */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 6E */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 6F */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 70 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 71 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 72 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 73 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 74 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 75 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 76 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 77 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 78 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 79 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 7A */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 7B */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 7C */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 7D */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 7E */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 7F */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 80 */ { 0x01, 0x01, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 81 */ { 0x01, 0x01, 0x01, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 82 */ { 0x01, 0x01, 0x01, 0x01, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 83 */ { 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 84 */ { 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 85 */ { 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 86 */ { 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 87 */ { 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 88 */ { 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 89 */ { 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x80, 0x80, 0x80, 0x80 },
+		/* 8A */ { 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x80, 0x80, 0x80 },
+		/* 8B */ { 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x80, 0x80 },
+		/* 8C */ { 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x80 },
+		/* 8D */ { 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01 },
+		/* 8E */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 8F */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 90 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 91 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 92 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 93 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 94 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 95 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 96 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 97 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 98 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 99 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 9A */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 9B */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 9C */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 9D */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 9E */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 9F */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* A0 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* A1 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* A2 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* A3 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* A4 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* A5 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* A6 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* A7 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* A8 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* A9 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* AA */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* AB */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* AC */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* AD */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* AE */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* AF */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* B0 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* B1 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* B2 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* B3 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* B4 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* B5 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* B6 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* B7 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* B8 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* B9 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* BA */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* BB */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* BC */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* BD */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* BE */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* BF */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* C0 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* C1 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* C2 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* C3 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* C4 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* C5 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* C6 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* C7 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* C8 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* C9 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* CA */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* CB */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* CC */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* CD */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* CE */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* CF */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* D0 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* D1 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* D2 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* D3 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* D4 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* D5 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* D6 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* D7 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* D8 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* D9 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* DA */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* DB */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* DC */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* DD */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* DE */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* DF */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* E0 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* E1 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* E2 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* E3 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* E4 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* E5 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* E6 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* E7 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* E8 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* E9 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* EA */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* EB */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* EC */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* ED */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* EE */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* EF */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* F0 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* F1 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* F2 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* F3 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* F4 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* F5 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* F6 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* F7 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* F8 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* F9 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* FA */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* FB */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* FC */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* FD */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* FE */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* FF */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+	},
+	{
+		  2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,  16,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+		  2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	},
+	{
+		  1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+		  3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,  16,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	},
+	{
+		  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	},
+	{
+		  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	},
+};
+
+static struct rle8_tbl rle8_table_icns = {
+	"icns",
+	(1U << RLE_OP_CPY) /* 128 */ | (1U << RLE_OP_REP) /* 128 */,
+	{
+		// RLE_OP_CPY 0..255
+		(int16_t[]){ -1,0x00,0x01,0x02,0x03,0x04,0x05,0x06,0x07,0x08,0x09,0x0a,0x0b,0x0c,0x0d,0x0e,0x0f,0x10,0x11,0x12,0x13,0x14,0x15,0x16,0x17,0x18,0x19,0x1a,0x1b,0x1c,0x1d,0x1e,0x1f,0x20,0x21,0x22,0x23,0x24,0x25,0x26,0x27,0x28,0x29,0x2a,0x2b,0x2c,0x2d,0x2e,0x2f,0x30,0x31,0x32,0x33,0x34,0x35,0x36,0x37,0x38,0x39,0x3a,0x3b,0x3c,0x3d,0x3e,0x3f,0x40,0x41,0x42,0x43,0x44,0x45,0x46,0x47,0x48,0x49,0x4a,0x4b,0x4c,0x4d,0x4e,0x4f,0x50,0x51,0x52,0x53,0x54,0x55,0x56,0x57,0x58,0x59,0x5a,0x5b,0x5c,0x5d,0x5e,0x5f,0x60,0x61,0x62,0x63,0x64,0x65,0x66,0x67,0x68,0x69,0x6a,0x6b,0x6c,0x6d,0x6e,0x6f,0x70,0x71,0x72,0x73,0x74,0x75,0x76,0x77,0x78,0x79,0x7a,0x7b,0x7c,0x7d,0x7e,0x7f,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1 },
+		// RLE_OP_REP 0..255
+		(int16_t[]){ -1,-1,-1,0x80,0x81,0x82,0x83,0x84,0x85,0x86,0x87,0x88,0x89,0x8a,0x8b,0x8c,0x8d,0x8e,0x8f,0x90,0x91,0x92,0x93,0x94,0x95,0x96,0x97,0x98,0x99,0x9a,0x9b,0x9c,0x9d,0x9e,0x9f,0xa0,0xa1,0xa2,0xa3,0xa4,0xa5,0xa6,0xa7,0xa8,0xa9,0xaa,0xab,0xac,0xad,0xae,0xaf,0xb0,0xb1,0xb2,0xb3,0xb4,0xb5,0xb6,0xb7,0xb8,0xb9,0xba,0xbb,0xbc,0xbd,0xbe,0xbf,0xc0,0xc1,0xc2,0xc3,0xc4,0xc5,0xc6,0xc7,0xc8,0xc9,0xca,0xcb,0xcc,0xcd,0xce,0xcf,0xd0,0xd1,0xd2,0xd3,0xd4,0xd5,0xd6,0xd7,0xd8,0xd9,0xda,0xdb,0xdc,0xdd,0xde,0xdf,0xe0,0xe1,0xe2,0xe3,0xe4,0xe5,0xe6,0xe7,0xe8,0xe9,0xea,0xeb,0xec,0xed,0xee,0xef,0xf0,0xf1,0xf2,0xf3,0xf4,0xf5,0xf6,0xf7,0xf8,0xf9,0xfa,0xfb,0xfc,0xfd,0xfe,0xff,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1 },
+		NULL,
+	},
+	rle8_tbl_decode_icns,
+	rle8_tbl_step_icns,
+	&rle8_tbl_simd_icns,
+	{
+		{ 1, 128 }, // min-max CPY
+		{ 3, 130 }, // min-max REP
+		{ -1, -1 }, // no LIT
+	}
+};
@@ -0,0 +1,461 @@
+// Generated by rle-genops from https://github.com/eloj/rle-zoo
+
+// Decode table for RLE8 variant 'pcx'
+static struct rle8 rle8_tbl_decode_pcx[256] = {
+ /* 00 */ { RLE_OP_LIT,   0 }, /* 01 */ { RLE_OP_LIT,   1 }, /* 02 */ { RLE_OP_LIT,   2 }, /* 03 */ { RLE_OP_LIT,   3 },
+ /* 04 */ { RLE_OP_LIT,   4 }, /* 05 */ { RLE_OP_LIT,   5 }, /* 06 */ { RLE_OP_LIT,   6 }, /* 07 */ { RLE_OP_LIT,   7 },
+ /* 08 */ { RLE_OP_LIT,   8 }, /* 09 */ { RLE_OP_LIT,   9 }, /* 0A */ { RLE_OP_LIT,  10 }, /* 0B */ { RLE_OP_LIT,  11 },
+ /* 0C */ { RLE_OP_LIT,  12 }, /* 0D */ { RLE_OP_LIT,  13 }, /* 0E */ { RLE_OP_LIT,  14 }, /* 0F */ { RLE_OP_LIT,  15 },
+ /* 10 */ { RLE_OP_LIT,  16 }, /* 11 */ { RLE_OP_LIT,  17 }, /* 12 */ { RLE_OP_LIT,  18 }, /* 13 */ { RLE_OP_LIT,  19 },
+ /* 14 */ { RLE_OP_LIT,  20 }, /* 15 */ { RLE_OP_LIT,  21 }, /* 16 */ { RLE_OP_LIT,  22 }, /* 17 */ { RLE_OP_LIT,  23 },
+ /* 18 */ { RLE_OP_LIT,  24 }, /* 19 */ { RLE_OP_LIT,  25 }, /* 1A */ { RLE_OP_LIT,  26 }, /* 1B */ { RLE_OP_LIT,  27 },
+ /* 1C */ { RLE_OP_LIT,  28 }, /* 1D */ { RLE_OP_LIT,  29 }, /* 1E */ { RLE_OP_LIT,  30 }, /* 1F */ { RLE_OP_LIT,  31 },
+ /* 20 */ { RLE_OP_LIT,  32 }, /* 21 */ { RLE_OP_LIT,  33 }, /* 22 */ { RLE_OP_LIT,  34 }, /* 23 */ { RLE_OP_LIT,  35 },
+ /* 24 */ { RLE_OP_LIT,  36 }, /* 25 */ { RLE_OP_LIT,  37 }, /* 26 */ { RLE_OP_LIT,  38 }, /* 27 */ { RLE_OP_LIT,  39 },
+ /* 28 */ { RLE_OP_LIT,  40 }, /* 29 */ { RLE_OP_LIT,  41 }, /* 2A */ { RLE_OP_LIT,  42 }, /* 2B */ { RLE_OP_LIT,  43 },
+ /* 2C */ { RLE_OP_LIT,  44 }, /* 2D */ { RLE_OP_LIT,  45 }, /* 2E */ { RLE_OP_LIT,  46 }, /* 2F */ { RLE_OP_LIT,  47 },
+ /* 30 */ { RLE_OP_LIT,  48 }, /* 31 */ { RLE_OP_LIT,  49 }, /* 32 */ { RLE_OP_LIT,  50 }, /* 33 */ { RLE_OP_LIT,  51 },
+ /* 34 */ { RLE_OP_LIT,  52 }, /* 35 */ { RLE_OP_LIT,  53 }, /* 36 */ { RLE_OP_LIT,  54 }, /* 37 */ { RLE_OP_LIT,  55 },
+ /* 38 */ { RLE_OP_LIT,  56 }, /* 39 */ { RLE_OP_LIT,  57 }, /* 3A */ { RLE_OP_LIT,  58 }, /* 3B */ { RLE_OP_LIT,  59 },
+ /* 3C */ { RLE_OP_LIT,  60 }, /* 3D */ { RLE_OP_LIT,  61 }, /* 3E */ { RLE_OP_LIT,  62 }, /* 3F */ { RLE_OP_LIT,  63 },
+ /* 40 */ { RLE_OP_LIT,  64 }, /* 41 */ { RLE_OP_LIT,  65 }, /* 42 */ { RLE_OP_LIT,  66 }, /* 43 */ { RLE_OP_LIT,  67 },
+ /* 44 */ { RLE_OP_LIT,  68 }, /* 45 */ { RLE_OP_LIT,  69 }, /* 46 */ { RLE_OP_LIT,  70 }, /* 47 */ { RLE_OP_LIT,  71 },
+ /* 48 */ { RLE_OP_LIT,  72 }, /* 49 */ { RLE_OP_LIT,  73 }, /* 4A */ { RLE_OP_LIT,  74 }, /* 4B */ { RLE_OP_LIT,  75 },
+ /* 4C */ { RLE_OP_LIT,  76 }, /* 4D */ { RLE_OP_LIT,  77 }, /* 4E */ { RLE_OP_LIT,  78 }, /* 4F */ { RLE_OP_LIT,  79 },
+ /* 50 */ { RLE_OP_LIT,  80 }, /* 51 */ { RLE_OP_LIT,  81 }, /* 52 */ { RLE_OP_LIT,  82 }, /* 53 */ { RLE_OP_LIT,  83 },
+ /* 54 */ { RLE_OP_LIT,  84 }, /* 55 */ { RLE_OP_LIT,  85 }, /* 56 */ { RLE_OP_LIT,  86 }, /* 57 */ { RLE_OP_LIT,  87 },
+ /* 58 */ { RLE_OP_LIT,  88 }, /* 59 */ { RLE_OP_LIT,  89 }, /* 5A */ { RLE_OP_LIT,  90 }, /* 5B */ { RLE_OP_LIT,  91 },
+ /* 5C */ { RLE_OP_LIT,  92 }, /* 5D */ { RLE_OP_LIT,  93 }, /* 5E */ { RLE_OP_LIT,  94 }, /* 5F */ { RLE_OP_LIT,  95 },
+ /* 60 */ { RLE_OP_LIT,  96 }, /* 61 */ { RLE_OP_LIT,  97 }, /* 62 */ { RLE_OP_LIT,  98 }, /* 63 */ { RLE_OP_LIT,  99 },
+ /* 64 */ { RLE_OP_LIT, 100 }, /* 65 */ { RLE_OP_LIT, 101 }, /* 66 */ { RLE_OP_LIT, 102 }, /* 67 */ { RLE_OP_LIT, 103 },
+ /* 68 */ { RLE_OP_LIT, 104 }, /* 69 */ { RLE_OP_LIT, 105 }, /* 6A */ { RLE_OP_LIT, 106 }, /* 6B */ { RLE_OP_LIT, 107 },
+ /* 6C */ { RLE_OP_LIT, 108 }, /* 6D */ { RLE_OP_LIT, 109 }, /* 6E */ { RLE_OP_LIT, 110 }, /* 6F */ { RLE_OP_LIT, 111 },
+ /* 70 */ { RLE_OP_LIT, 112 }, /* 71 */ { RLE_OP_LIT, 113 }, /* 72 */ { RLE_OP_LIT, 114 }, /* 73 */ { RLE_OP_LIT, 115 },
+ /* 74 */ { RLE_OP_LIT, 116 }, /* 75 */ { RLE_OP_LIT, 117 }, /* 76 */ { RLE_OP_LIT, 118 }, /* 77 */ { RLE_OP_LIT, 119 },
+ /* 78 */ { RLE_OP_LIT, 120 }, /* 79 */ { RLE_OP_LIT, 121 }, /* 7A */ { RLE_OP_LIT, 122 }, /* 7B */ { RLE_OP_LIT, 123 },
+ /* 7C */ { RLE_OP_LIT, 124 }, /* 7D */ { RLE_OP_LIT, 125 }, /* 7E */ { RLE_OP_LIT, 126 }, /* 7F */ { RLE_OP_LIT, 127 },
+ /* 80 */ { RLE_OP_LIT, 128 }, /* 81 */ { RLE_OP_LIT, 129 }, /* 82 */ { RLE_OP_LIT, 130 }, /* 83 */ { RLE_OP_LIT, 131 },
+ /* 84 */ { RLE_OP_LIT, 132 }, /* 85 */ { RLE_OP_LIT, 133 }, /* 86 */ { RLE_OP_LIT, 134 }, /* 87 */ { RLE_OP_LIT, 135 },
+ /* 88 */ { RLE_OP_LIT, 136 }, /* 89 */ { RLE_OP_LIT, 137 }, /* 8A */ { RLE_OP_LIT, 138 }, /* 8B */ { RLE_OP_LIT, 139 },
+ /* 8C */ { RLE_OP_LIT, 140 }, /* 8D */ { RLE_OP_LIT, 141 }, /* 8E */ { RLE_OP_LIT, 142 }, /* 8F */ { RLE_OP_LIT, 143 },
+ /* 90 */ { RLE_OP_LIT, 144 }, /* 91 */ { RLE_OP_LIT, 145 }, /* 92 */ { RLE_OP_LIT, 146 }, /* 93 */ { RLE_OP_LIT, 147 },
+ /* 94 */ { RLE_OP_LIT, 148 }, /* 95 */ { RLE_OP_LIT, 149 }, /* 96 */ { RLE_OP_LIT, 150 }, /* 97 */ { RLE_OP_LIT, 151 },
+ /* 98 */ { RLE_OP_LIT, 152 }, /* 99 */ { RLE_OP_LIT, 153 }, /* 9A */ { RLE_OP_LIT, 154 }, /* 9B */ { RLE_OP_LIT, 155 },
+ /* 9C */ { RLE_OP_LIT, 156 }, /* 9D */ { RLE_OP_LIT, 157 }, /* 9E */ { RLE_OP_LIT, 158 }, /* 9F */ { RLE_OP_LIT, 159 },
+ /* A0 */ { RLE_OP_LIT, 160 }, /* A1 */ { RLE_OP_LIT, 161 }, /* A2 */ { RLE_OP_LIT, 162 }, /* A3 */ { RLE_OP_LIT, 163 },
+ /* A4 */ { RLE_OP_LIT, 164 }, /* A5 */ { RLE_OP_LIT, 165 }, /* A6 */ { RLE_OP_LIT, 166 }, /* A7 */ { RLE_OP_LIT, 167 },
+ /* A8 */ { RLE_OP_LIT, 168 }, /* A9 */ { RLE_OP_LIT, 169 }, /* AA */ { RLE_OP_LIT, 170 }, /* AB */ { RLE_OP_LIT, 171 },
+ /* AC */ { RLE_OP_LIT, 172 }, /* AD */ { RLE_OP_LIT, 173 }, /* AE */ { RLE_OP_LIT, 174 }, /* AF */ { RLE_OP_LIT, 175 },
+ /* B0 */ { RLE_OP_LIT, 176 }, /* B1 */ { RLE_OP_LIT, 177 }, /* B2 */ { RLE_OP_LIT, 178 }, /* B3 */ { RLE_OP_LIT, 179 },
+ /* B4 */ { RLE_OP_LIT, 180 }, /* B5 */ { RLE_OP_LIT, 181 }, /* B6 */ { RLE_OP_LIT, 182 }, /* B7 */ { RLE_OP_LIT, 183 },
+ /* B8 */ { RLE_OP_LIT, 184 }, /* B9 */ { RLE_OP_LIT, 185 }, /* BA */ { RLE_OP_LIT, 186 }, /* BB */ { RLE_OP_LIT, 187 },
+ /* BC */ { RLE_OP_LIT, 188 }, /* BD */ { RLE_OP_LIT, 189 }, /* BE */ { RLE_OP_LIT, 190 }, /* BF */ { RLE_OP_LIT, 191 },
+ /* C0 */ { RLE_OP_REP,   0 }, /* C1 */ { RLE_OP_REP,   1 }, /* C2 */ { RLE_OP_REP,   2 }, /* C3 */ { RLE_OP_REP,   3 },
+ /* C4 */ { RLE_OP_REP,   4 }, /* C5 */ { RLE_OP_REP,   5 }, /* C6 */ { RLE_OP_REP,   6 }, /* C7 */ { RLE_OP_REP,   7 },
+ /* C8 */ { RLE_OP_REP,   8 }, /* C9 */ { RLE_OP_REP,   9 }, /* CA */ { RLE_OP_REP,  10 }, /* CB */ { RLE_OP_REP,  11 },
+ /* CC */ { RLE_OP_REP,  12 }, /* CD */ { RLE_OP_REP,  13 }, /* CE */ { RLE_OP_REP,  14 }, /* CF */ { RLE_OP_REP,  15 },
+ /* D0 */ { RLE_OP_REP,  16 }, /* D1 */ { RLE_OP_REP,  17 }, /* D2 */ { RLE_OP_REP,  18 }, /* D3 */ { RLE_OP_REP,  19 },
+ /* D4 */ { RLE_OP_REP,  20 }, /* D5 */ { RLE_OP_REP,  21 }, /* D6 */ { RLE_OP_REP,  22 }, /* D7 */ { RLE_OP_REP,  23 },
+ /* D8 */ { RLE_OP_REP,  24 }, /* D9 */ { RLE_OP_REP,  25 }, /* DA */ { RLE_OP_REP,  26 }, /* DB */ { RLE_OP_REP,  27 },
+ /* DC */ { RLE_OP_REP,  28 }, /* DD */ { RLE_OP_REP,  29 }, /* DE */ { RLE_OP_REP,  30 }, /* DF */ { RLE_OP_REP,  31 },
+ /* E0 */ { RLE_OP_REP,  32 }, /* E1 */ { RLE_OP_REP,  33 }, /* E2 */ { RLE_OP_REP,  34 }, /* E3 */ { RLE_OP_REP,  35 },
+ /* E4 */ { RLE_OP_REP,  36 }, /* E5 */ { RLE_OP_REP,  37 }, /* E6 */ { RLE_OP_REP,  38 }, /* E7 */ { RLE_OP_REP,  39 },
+ /* E8 */ { RLE_OP_REP,  40 }, /* E9 */ { RLE_OP_REP,  41 }, /* EA */ { RLE_OP_REP,  42 }, /* EB */ { RLE_OP_REP,  43 },
+ /* EC */ { RLE_OP_REP,  44 }, /* ED */ { RLE_OP_REP,  45 }, /* EE */ { RLE_OP_REP,  46 }, /* EF */ { RLE_OP_REP,  47 },
+ /* F0 */ { RLE_OP_REP,  48 }, /* F1 */ { RLE_OP_REP,  49 }, /* F2 */ { RLE_OP_REP,  50 }, /* F3 */ { RLE_OP_REP,  51 },
+ /* F4 */ { RLE_OP_REP,  52 }, /* F5 */ { RLE_OP_REP,  53 }, /* F6 */ { RLE_OP_REP,  54 }, /* F7 */ { RLE_OP_REP,  55 },
+ /* F8 */ { RLE_OP_REP,  56 }, /* F9 */ { RLE_OP_REP,  57 }, /* FA */ { RLE_OP_REP,  58 }, /* FB */ { RLE_OP_REP,  59 },
+ /* FC */ { RLE_OP_REP,  60 }, /* FD */ { RLE_OP_REP,  61 }, /* FE */ { RLE_OP_REP,  62 }, /* FF */ { RLE_OP_REP,  63 }
+};
+
+// Step table for RLE8 variant 'pcx'
+static struct rle8_step rle8_tbl_step_pcx[256] = {
+ /* 00 */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 01 */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 02 */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 03 */ { RLE_OP_LIT, 0, 0,   1,   1 },
+ /* 04 */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 05 */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 06 */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 07 */ { RLE_OP_LIT, 0, 0,   1,   1 },
+ /* 08 */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 09 */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 0A */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 0B */ { RLE_OP_LIT, 0, 0,   1,   1 },
+ /* 0C */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 0D */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 0E */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 0F */ { RLE_OP_LIT, 0, 0,   1,   1 },
+ /* 10 */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 11 */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 12 */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 13 */ { RLE_OP_LIT, 0, 0,   1,   1 },
+ /* 14 */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 15 */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 16 */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 17 */ { RLE_OP_LIT, 0, 0,   1,   1 },
+ /* 18 */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 19 */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 1A */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 1B */ { RLE_OP_LIT, 0, 0,   1,   1 },
+ /* 1C */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 1D */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 1E */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 1F */ { RLE_OP_LIT, 0, 0,   1,   1 },
+ /* 20 */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 21 */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 22 */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 23 */ { RLE_OP_LIT, 0, 0,   1,   1 },
+ /* 24 */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 25 */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 26 */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 27 */ { RLE_OP_LIT, 0, 0,   1,   1 },
+ /* 28 */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 29 */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 2A */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 2B */ { RLE_OP_LIT, 0, 0,   1,   1 },
+ /* 2C */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 2D */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 2E */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 2F */ { RLE_OP_LIT, 0, 0,   1,   1 },
+ /* 30 */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 31 */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 32 */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 33 */ { RLE_OP_LIT, 0, 0,   1,   1 },
+ /* 34 */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 35 */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 36 */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 37 */ { RLE_OP_LIT, 0, 0,   1,   1 },
+ /* 38 */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 39 */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 3A */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 3B */ { RLE_OP_LIT, 0, 0,   1,   1 },
+ /* 3C */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 3D */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 3E */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 3F */ { RLE_OP_LIT, 0, 0,   1,   1 },
+ /* 40 */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 41 */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 42 */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 43 */ { RLE_OP_LIT, 0, 0,   1,   1 },
+ /* 44 */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 45 */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 46 */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 47 */ { RLE_OP_LIT, 0, 0,   1,   1 },
+ /* 48 */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 49 */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 4A */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 4B */ { RLE_OP_LIT, 0, 0,   1,   1 },
+ /* 4C */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 4D */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 4E */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 4F */ { RLE_OP_LIT, 0, 0,   1,   1 },
+ /* 50 */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 51 */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 52 */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 53 */ { RLE_OP_LIT, 0, 0,   1,   1 },
+ /* 54 */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 55 */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 56 */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 57 */ { RLE_OP_LIT, 0, 0,   1,   1 },
+ /* 58 */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 59 */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 5A */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 5B */ { RLE_OP_LIT, 0, 0,   1,   1 },
+ /* 5C */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 5D */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 5E */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 5F */ { RLE_OP_LIT, 0, 0,   1,   1 },
+ /* 60 */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 61 */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 62 */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 63 */ { RLE_OP_LIT, 0, 0,   1,   1 },
+ /* 64 */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 65 */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 66 */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 67 */ { RLE_OP_LIT, 0, 0,   1,   1 },
+ /* 68 */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 69 */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 6A */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 6B */ { RLE_OP_LIT, 0, 0,   1,   1 },
+ /* 6C */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 6D */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 6E */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 6F */ { RLE_OP_LIT, 0, 0,   1,   1 },
+ /* 70 */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 71 */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 72 */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 73 */ { RLE_OP_LIT, 0, 0,   1,   1 },
+ /* 74 */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 75 */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 76 */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 77 */ { RLE_OP_LIT, 0, 0,   1,   1 },
+ /* 78 */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 79 */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 7A */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 7B */ { RLE_OP_LIT, 0, 0,   1,   1 },
+ /* 7C */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 7D */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 7E */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 7F */ { RLE_OP_LIT, 0, 0,   1,   1 },
+ /* 80 */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 81 */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 82 */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 83 */ { RLE_OP_LIT, 0, 0,   1,   1 },
+ /* 84 */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 85 */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 86 */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 87 */ { RLE_OP_LIT, 0, 0,   1,   1 },
+ /* 88 */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 89 */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 8A */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 8B */ { RLE_OP_LIT, 0, 0,   1,   1 },
+ /* 8C */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 8D */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 8E */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 8F */ { RLE_OP_LIT, 0, 0,   1,   1 },
+ /* 90 */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 91 */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 92 */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 93 */ { RLE_OP_LIT, 0, 0,   1,   1 },
+ /* 94 */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 95 */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 96 */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 97 */ { RLE_OP_LIT, 0, 0,   1,   1 },
+ /* 98 */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 99 */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 9A */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 9B */ { RLE_OP_LIT, 0, 0,   1,   1 },
+ /* 9C */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 9D */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 9E */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* 9F */ { RLE_OP_LIT, 0, 0,   1,   1 },
+ /* A0 */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* A1 */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* A2 */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* A3 */ { RLE_OP_LIT, 0, 0,   1,   1 },
+ /* A4 */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* A5 */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* A6 */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* A7 */ { RLE_OP_LIT, 0, 0,   1,   1 },
+ /* A8 */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* A9 */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* AA */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* AB */ { RLE_OP_LIT, 0, 0,   1,   1 },
+ /* AC */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* AD */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* AE */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* AF */ { RLE_OP_LIT, 0, 0,   1,   1 },
+ /* B0 */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* B1 */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* B2 */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* B3 */ { RLE_OP_LIT, 0, 0,   1,   1 },
+ /* B4 */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* B5 */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* B6 */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* B7 */ { RLE_OP_LIT, 0, 0,   1,   1 },
+ /* B8 */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* B9 */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* BA */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* BB */ { RLE_OP_LIT, 0, 0,   1,   1 },
+ /* BC */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* BD */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* BE */ { RLE_OP_LIT, 0, 0,   1,   1 }, /* BF */ { RLE_OP_LIT, 0, 0,   1,   1 },
+ /* C0 */ { RLE_OP_REP, 1, 0,   0,   2 }, /* C1 */ { RLE_OP_REP, 1, 0,   1,   2 }, /* C2 */ { RLE_OP_REP, 1, 0,   2,   2 }, /* C3 */ { RLE_OP_REP, 1, 0,   3,   2 },
+ /* C4 */ { RLE_OP_REP, 1, 0,   4,   2 }, /* C5 */ { RLE_OP_REP, 1, 0,   5,   2 }, /* C6 */ { RLE_OP_REP, 1, 0,   6,   2 }, /* C7 */ { RLE_OP_REP, 1, 0,   7,   2 },
+ /* C8 */ { RLE_OP_REP, 1, 0,   8,   2 }, /* C9 */ { RLE_OP_REP, 1, 0,   9,   2 }, /* CA */ { RLE_OP_REP, 1, 0,  10,   2 }, /* CB */ { RLE_OP_REP, 1, 0,  11,   2 },
+ /* CC */ { RLE_OP_REP, 1, 0,  12,   2 }, /* CD */ { RLE_OP_REP, 1, 0,  13,   2 }, /* CE */ { RLE_OP_REP, 1, 0,  14,   2 }, /* CF */ { RLE_OP_REP, 1, 0,  15,   2 },
+ /* D0 */ { RLE_OP_REP, 1, 0,  16,   2 }, /* D1 */ { RLE_OP_REP, 1, 0,  17,   2 }, /* D2 */ { RLE_OP_REP, 1, 0,  18,   2 }, /* D3 */ { RLE_OP_REP, 1, 0,  19,   2 },
+ /* D4 */ { RLE_OP_REP, 1, 0,  20,   2 }, /* D5 */ { RLE_OP_REP, 1, 0,  21,   2 }, /* D6 */ { RLE_OP_REP, 1, 0,  22,   2 }, /* D7 */ { RLE_OP_REP, 1, 0,  23,   2 },
+ /* D8 */ { RLE_OP_REP, 1, 0,  24,   2 }, /* D9 */ { RLE_OP_REP, 1, 0,  25,   2 }, /* DA */ { RLE_OP_REP, 1, 0,  26,   2 }, /* DB */ { RLE_OP_REP, 1, 0,  27,   2 },
+ /* DC */ { RLE_OP_REP, 1, 0,  28,   2 }, /* DD */ { RLE_OP_REP, 1, 0,  29,   2 }, /* DE */ { RLE_OP_REP, 1, 0,  30,   2 }, /* DF */ { RLE_OP_REP, 1, 0,  31,   2 },
+ /* E0 */ { RLE_OP_REP, 1, 0,  32,   2 }, /* E1 */ { RLE_OP_REP, 1, 0,  33,   2 }, /* E2 */ { RLE_OP_REP, 1, 0,  34,   2 }, /* E3 */ { RLE_OP_REP, 1, 0,  35,   2 },
+ /* E4 */ { RLE_OP_REP, 1, 0,  36,   2 }, /* E5 */ { RLE_OP_REP, 1, 0,  37,   2 }, /* E6 */ { RLE_OP_REP, 1, 0,  38,   2 }, /* E7 */ { RLE_OP_REP, 1, 0,  39,   2 },
+ /* E8 */ { RLE_OP_REP, 1, 0,  40,   2 }, /* E9 */ { RLE_OP_REP, 1, 0,  41,   2 }, /* EA */ { RLE_OP_REP, 1, 0,  42,   2 }, /* EB */ { RLE_OP_REP, 1, 0,  43,   2 },
+ /* EC */ { RLE_OP_REP, 1, 0,  44,   2 }, /* ED */ { RLE_OP_REP, 1, 0,  45,   2 }, /* EE */ { RLE_OP_REP, 1, 0,  46,   2 }, /* EF */ { RLE_OP_REP, 1, 0,  47,   2 },
+ /* F0 */ { RLE_OP_REP, 1, 0,  48,   2 }, /* F1 */ { RLE_OP_REP, 1, 0,  49,   2 }, /* F2 */ { RLE_OP_REP, 1, 0,  50,   2 }, /* F3 */ { RLE_OP_REP, 1, 0,  51,   2 },
+ /* F4 */ { RLE_OP_REP, 1, 0,  52,   2 }, /* F5 */ { RLE_OP_REP, 1, 0,  53,   2 }, /* F6 */ { RLE_OP_REP, 1, 0,  54,   2 }, /* F7 */ { RLE_OP_REP, 1, 0,  55,   2 },
+ /* F8 */ { RLE_OP_REP, 1, 0,  56,   2 }, /* F9 */ { RLE_OP_REP, 1, 0,  57,   2 }, /* FA */ { RLE_OP_REP, 1, 0,  58,   2 }, /* FB */ { RLE_OP_REP, 1, 0,  59,   2 },
+ /* FC */ { RLE_OP_REP, 1, 0,  60,   2 }, /* FD */ { RLE_OP_REP, 1, 0,  61,   2 }, /* FE */ { RLE_OP_REP, 1, 0,  62,   2 }, /* FF */ { RLE_OP_REP, 1, 0,  63,   2 }
+};
+
+// SIMD tables for RLE8 variant 'pcx'
+static struct rle8_simd rle8_tbl_simd_pcx = {
+	{
+		/* 00 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 01 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 02 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 03 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 04 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 05 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 06 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 07 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 08 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 09 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 0A */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 0B */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 0C */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 0D */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 0E */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 0F */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 10 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 11 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 12 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 13 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 14 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 15 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 16 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 17 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 18 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 19 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 1A */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 1B */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 1C */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 1D */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 1E */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 1F */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 20 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 21 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 22 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 23 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 24 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 25 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 26 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 27 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 28 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 29 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 2A */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 2B */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 2C */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 2D */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 2E */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 2F */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 30 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 31 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 32 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 33 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 34 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 35 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 36 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 37 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 38 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 39 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 3A */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 3B */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 3C */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 3D */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 3E */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 3F */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 40 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 41 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 42 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 43 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 44 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 45 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 46 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 47 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 48 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 49 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 4A */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 4B */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 4C */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 4D */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 4E */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 4F */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 50 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 51 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 52 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 53 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 54 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 55 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 56 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 57 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 58 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 59 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 5A */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 5B */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 5C */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 5D */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 5E */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 5F */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 60 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 61 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 62 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 63 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 64 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 65 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 66 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 67 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 68 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 69 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 6A */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 6B */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 6C */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 6D */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 6E */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 6F */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 70 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 71 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 72 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 73 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 74 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 75 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 76 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 77 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 78 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 79 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 7A */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 7B */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 7C */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 7D */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 7E */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 7F */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 80 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 81 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 82 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 83 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 84 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 85 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 86 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 87 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 88 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 89 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 8A */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 8B */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 8C */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 8D */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 8E */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 8F */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 90 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 91 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 92 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 93 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 94 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 95 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 96 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 97 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 98 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 99 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 9A */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 9B */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 9C */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 9D */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 9E */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* 9F */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* A0 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* A1 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* A2 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* A3 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* A4 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* A5 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* A6 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* A7 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* A8 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* A9 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* AA */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* AB */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* AC */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* AD */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* AE */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* AF */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* B0 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* B1 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* B2 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* B3 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* B4 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* B5 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* B6 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* B7 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* B8 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* B9 */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* BA */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* BB */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* BC */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* BD */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* BE */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* BF */ { 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* C0 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* C1 */ { 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* C2 */ { 0x01, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* C3 */ { 0x01, 0x01, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* C4 */ { 0x01, 0x01, 0x01, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* C5 */ { 0x01, 0x01, 0x01, 0x01, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* C6 */ { 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* C7 */ { 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* C8 */ { 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* C9 */ { 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* CA */ { 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* CB */ { 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* CC */ { 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x80, 0x80, 0x80, 0x80 },
+		/* CD */ { 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x80, 0x80, 0x80 },
+		/* CE */ { 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x80, 0x80 },
+		/* CF */ { 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x80 },
+		/* D0 */ { 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01 },
+		/* D1 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* D2 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* D3 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* D4 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* D5 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* D6 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* D7 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* D8 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* D9 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* DA */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* DB */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* DC */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* DD */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* DE */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* DF */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* E0 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* E1 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* E2 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* E3 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* E4 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* E5 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* E6 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* E7 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* E8 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* E9 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* EA */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* EB */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* EC */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* ED */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* EE */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* EF */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* F0 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* F1 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* F2 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* F3 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* F4 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* F5 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* F6 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* F7 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* F8 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* F9 */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* FA */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* FB */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* FC */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* FD */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* FE */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+		/* FF */ { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+	},
+	{
+		  1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+		  1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+		  1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+		  1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+		  1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+		  1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+		  1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+		  1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+		  1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+		  1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+		  1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+		  1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+		  2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+		  2,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	},
+	{
+		  1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+		  1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+		  1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+		  1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+		  1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+		  1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+		  1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+		  1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+		  1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+		  1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+		  1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+		  1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+		  0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+		 16,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+		  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	},
+	{
+		  1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+	},
+	{
+		  1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   0,   0,   0,   0,
+	},
+};
+
+static struct rle8_tbl rle8_table_pcx = {
+	"pcx",
+	(1U << RLE_OP_REP) /* 64 */ | (1U << RLE_OP_LIT) /* 192 */,
+	{
+		NULL,
+		// RLE_OP_REP 0..255
+		(int16_t[]){ 0xc0,0xc1,0xc2,0xc3,0xc4,0xc5,0xc6,0xc7,0xc8,0xc9,0xca,0xcb,0xcc,0xcd,0xce,0xcf,0xd0,0xd1,0xd2,0xd3,0xd4,0xd5,0xd6,0xd7,0xd8,0xd9,0xda,0xdb,0xdc,0xdd,0xde,0xdf,0xe0,0xe1,0xe2,0xe3,0xe4,0xe5,0xe6,0xe7,0xe8,0xe9,0xea,0xeb,0xec,0xed,0xee,0xef,0xf0,0xf1,0xf2,0xf3,0xf4,0xf5,0xf6,0xf7,0xf8,0xf9,0xfa,0xfb,0xfc,0xfd,0xfe,0xff,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1 },
+		// RLE_OP_LIT 0..255
+		(int16_t[]){ 0x00,0x01,0x02,0x03,0x04,0x05,0x06,0x07,0x08,0x09,0x0a,0x0b,0x0c,0x0d,0x0e,0x0f,0x10,0x11,0x12,0x13,0x14,0x15,0x16,0x17,0x18,0x19,0x1a,0x1b,0x1c,0x1d,0x1e,0x1f,0x20,0x21,0x22,0x23,0x24,0x25,0x26,0x27,0x28,0x29,0x2a,0x2b,0x2c,0x2d,0x2e,0x2f,0x30,0x31,0x32,0x33,0x34,0x35,0x36,0x37,0x38,0x39,0x3a,0x3b,0x3c,0x3d,0x3e,0x3f,0x40,0x41,0x42,0x43,0x44,0x45,0x46,0x47,0x48,0x49,0x4a,0x4b,0x4c,0x4d,0x4e,0x4f,0x50,0x51,0x52,0x53,0x54,0x55,0x56,0x57,0x58,0x59,0x5a,0x5b,0x5c,0x5d,0x5e,0x5f,0x60,0x61,0x62,0x63,0x64,0x65,0x66,0x67,0x68,0x69,0x6a,0x6b,0x6c,0x6d,0x6e,0x6f,0x70,0x71,0x72,0x73,0x74,0x75,0x76,0x77,0x78,0x79,0x7a,0x7b,0x7c,0x7d,0x7e,0x7f,0x80,0x81,0x82,0x83,0x84,0x85,0x86,0x87,0x88,0x89,0x8a,0x8b,0x8c,0x8d,0x8e,0x8f,0x90,0x91,0x92,0x93,0x94,0x95,0x96,0x97,0x98,0x99,0x9a,0x9b,0x9c,0x9d,0x9e,0x9f,0xa0,0xa1,0xa2,0xa3,0xa4,0xa5,0xa6,0xa7,0xa8,0xa9,0xaa,0xab,0xac,0xad,0xae,0xaf,0xb0,0xb1,0xb2,0xb3,0xb4,0xb5,0xb6,0xb7,0xb8,0xb9,0xba,0xbb,0xbc,0xbd,0xbe,0xbf,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1,-1 },
+	},
+	rle8_tbl_decode_pcx,
+	rle8_tbl_step_pcx,
+	&rle8_tbl_simd_pcx,
+	{
+		{ -1, -1 }, // no CPY
+		{ 0, 63 }, // min-max REP
+		{ 0, 191 }, // min-max LIT
+	}
+};
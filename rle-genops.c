@@ -27,14 +27,24 @@
 typedef struct rle8 (*rle8_decode_fp)(uint8_t input);
 typedef struct rle8 (*rle8_encode_fp)(struct rle8 cmd);
 
-static int opt_usage, opt_genc;
+static int opt_usage, opt_genc, opt_gencodec, opt_gentests;
+static const char *opt_spec;
 
 static const char *gen_header = "// Generated by rle-genops from https://github.com/eloj/rle-zoo\n";
 
+// How the encoder of a variant picks its ops, where that doesn't follow from the op tables.
+struct rle8_policy {
+	int min_rep;	// Shortest run to encode as a REP.
+	int rep_last;	// Encode the last byte as a REP, even on its own.
+	int cpy_last;	// A CPY may end with the last byte.
+	int cpy_lookback;	// A CPY ends once it has taken `min_rep` same bytes, which are given back, not before two same bytes.
+};
+
 struct rle_parser {
 	const char *name;
 	rle8_encode_fp rle8_encode;
 	rle8_decode_fp rle8_decode;
+	struct rle8_policy policy;
 };
 
 static struct rle8 rle8_decode_packbits(uint8_t input) {
@@ -237,6 +247,112 @@ static void rle8_generate_decode_table(struct rle_parser *p) {
 }
 
 
+// Derive how the op is executed by the table-driven decoder, rle8_tbl_decompress().
+static void rle8_generate_step_table(struct rle_parser *p) {
+	printf("\n// Step table for RLE8 variant '%s'\n", p->name);
+
+	printf("static struct rle8_step rle8_tbl_step_%s[256] = {\n", p->name);
+
+	for (int i=0 ; i < 256 ; ++i) {
+		uint8_t b = i;
+		struct rle8_step step = rle8_step_from_op(p->rle8_decode(b));
+		printf(" /* %02X */ { RLE_OP_%s, %d, %d, %3d, %3d }", b, rle_op_cstr(step.op), step.src, step.stride, step.cnt, step.len);
+		if (i < 255) printf(",");
+		if ((i < 255) && ((i+1) % 4) == 0) printf("\n");
+	}
+
+	printf("\n};\n");
+}
+
+
+static void rle8_print_u8_array(const uint8_t *v, size_t n, const char *indent) {
+	for (size_t i = 0 ; i < n ; ++i) {
+		if (i % 16 == 0)
+			printf("%s", indent);
+		printf("%3d,", v[i]);
+		printf(i % 16 == 15 || i + 1 == n ? "\n" : " ");
+	}
+}
+
+// Derive the tables for decoding several short ops per step with SIMD shuffles; see struct rle8_simd.
+static void rle8_generate_simd_table(struct rle_parser *p) {
+	uint8_t inlen[256];
+	uint8_t outlen[256];
+	uint16_t lit_rows[16] = { 0 };
+
+	printf("\n// SIMD tables for RLE8 variant '%s'\n", p->name);
+	printf("static struct rle8_simd rle8_tbl_simd_%s = {\n", p->name);
+	printf("\t{\n");
+	for (int i=0 ; i < 256 ; ++i) {
+		uint8_t b = i;
+		struct rle8 cmd = p->rle8_decode(b);
+		struct rle8_step step = rle8_step_from_op(cmd);
+		// Short ops are those whose input, and output, are within one 16 byte vector.
+		int is_short = step.len > 0 && step.len <= 16 && step.cnt <= 16 &&
+			(step.cnt == 0 || step.src + (step.cnt - 1) * step.stride < 16);
+		inlen[i] = is_short ? step.len : 0;
+		outlen[i] = is_short ? step.cnt : 0;
+		if (cmd.op == RLE_OP_LIT)
+			lit_rows[b >> 4] |= 1U << (b & 15);
+
+		printf("\t\t/* %02X */ {", b);
+		for (int k=0 ; k < 16 ; ++k) {
+			int idx = is_short && k < step.cnt ? step.src + k * step.stride : 0x80;
+			printf(" 0x%02x%s", idx, k < 15 ? "," : "");
+		}
+		printf(" },\n");
+	}
+	printf("\t},\n");
+
+	printf("\t{\n");
+	rle8_print_u8_array(inlen, 256, "\t\t");
+	printf("\t},\n");
+	printf("\t{\n");
+	rle8_print_u8_array(outlen, 256, "\t\t");
+	printf("\t},\n");
+
+	// Classify LIT op bytes by nibble: every distinct row of low nibbles gets a bit, set in the high nibble
+	// entries of the rows with that pattern, and in the low nibble entries it contains. Without a bit to
+	// spare for every pattern, no byte is classified as a LIT.
+	uint8_t lit_lo[16] = { 0 };
+	uint8_t lit_hi[16] = { 0 };
+	uint16_t patterns[8];
+	size_t npatterns = 0;
+	for (int h=0 ; h < 16 && npatterns <= 8 ; ++h) {
+		if (lit_rows[h] == 0)
+			continue;
+		size_t k = 0;
+		while (k < npatterns && patterns[k] != lit_rows[h])
+			++k;
+		if (k == npatterns) {
+			if (npatterns == 8) {
+				++npatterns;
+				break;
+			}
+			patterns[npatterns++] = lit_rows[h];
+		}
+		lit_hi[h] = 1U << k;
+	}
+	if (npatterns > 8) {
+		memset(lit_hi, 0, sizeof(lit_hi));
+		npatterns = 0;
+	}
+	for (size_t k = 0 ; k < npatterns ; ++k) {
+		for (int l=0 ; l < 16 ; ++l) {
+			if (patterns[k] & (1U << l))
+				lit_lo[l] |= 1U << k;
+		}
+	}
+	printf("\t{\n");
+	rle8_print_u8_array(lit_lo, 16, "\t\t");
+	printf("\t},\n");
+	printf("\t{\n");
+	rle8_print_u8_array(lit_hi, 16, "\t\t");
+	printf("\t},\n");
+	printf("};\n");
+}
+
+
 static size_t rle8_generate_op_encode_array(struct rle_parser *p, int OP, char *buf, size_t bufsize) {
 	// TODO: This should be autodetected by max of valid CPY/REP/LIT encoding, rest padded to -1
 	int max_len = 256;
@@ -318,6 +434,8 @@ static void rle8_generate_encode_table(struct rle_parser *p) {
 	}
 	printf("\t},\n");
 	printf("\trle8_tbl_decode_%s,\n", p->name);
+	printf("\trle8_tbl_step_%s,\n", p->name);
+	printf("\t&rle8_tbl_simd_%s,\n", p->name);
 	printf("\t{\n");
 	for (int i = RLE_OP_CPY ; i < RLE_OP_NOP ; ++i) {
 		if (op_usage[i] > 0) {
@@ -334,29 +452,617 @@ static void rle8_generate_c_tables(struct rle_parser *p) {
 	printf("%s", gen_header);
 
 	rle8_generate_decode_table(p);
+	rle8_generate_step_table(p);
+	rle8_generate_simd_table(p);
 	rle8_generate_encode_table(p);
 }
 
+// A range of op bytes which decode to the same op, with a count of `base + slope * (b - lo)`.
+struct rle8_range {
+	int lo;
+	int hi;
+	enum RLE_OP op;
+	int base;
+	int slope;
+};
+
+static int rle8_is_counted(enum RLE_OP op) {
+	return op == RLE_OP_CPY || op == RLE_OP_REP;
+}
+
+static size_t rle8_find_ranges(struct rle_parser *p, struct rle8_range *ranges) {
+	size_t n = 0;
+	for (int i=0 ; i < 256 ; ++i) {
+		struct rle8 cmd = p->rle8_decode(i);
+		struct rle8_range *r = n > 0 ? &ranges[n - 1] : NULL;
+		if (r && r->op == cmd.op) {
+			if (!rle8_is_counted(cmd.op)) {
+				r->hi = i;
+				continue;
+			}
+			if (r->lo == r->hi && (cmd.cnt - r->base == 1 || cmd.cnt - r->base == -1)) {
+				r->slope = cmd.cnt - r->base;
+				r->hi = i;
+				continue;
+			}
+			if (r->lo < r->hi && cmd.cnt == r->base + r->slope * (i - r->lo)) {
+				r->hi = i;
+				continue;
+			}
+		}
+		ranges[n++] = (struct rle8_range){ i, i, cmd.op, cmd.cnt, 0 };
+	}
+	return n;
+}
+
+// Print the count of the op byte `b` in range `r` as a C expression.
+static void rle8_print_count(const struct rle8_range *r) {
+	int k = r->base - r->slope * r->lo;
+	if (r->slope == 0) {
+		printf("%d", r->base);
+	} else if (r->slope > 0) {
+		printf("(size_t)b %c %d", k < 0 ? '-' : '+', k < 0 ? -k : k);
+	} else {
+		printf("(size_t)(%d - b)", k);
+	}
+}
+
+// Print the op byte encoding `cnt` of the given op as a C expression, which must be linear.
+static void rle8_print_code(struct rle_parser *p, enum RLE_OP op, int lo, int hi) {
+	int c0 = p->rle8_encode((struct rle8){ op, lo }).cnt;
+	int slope = lo < hi ? ((p->rle8_encode((struct rle8){ op, lo + 1 }).cnt - c0) & 0xFF) : 1;
+	slope = slope == 0xFF ? -1 : slope;
+	int k = c0 - slope * lo;
+	for (int cnt = lo ; cnt <= hi ; ++cnt) {
+		if (p->rle8_encode((struct rle8){ op, cnt }).cnt != ((k + slope * cnt) & 0xFF)) {
+			fprintf(stderr, "error: Encoding of %s in variant '%s' isn't linear.\n", rle_op_cstr(op), p->name);
+			exit(1);
+		}
+	}
+	k &= 0xFF;
+	if (slope > 0 && k > 255 - lo)
+		printf("(uint8_t)(cnt - %d)", 256 - k);
+	else if (slope > 0)
+		printf("(uint8_t)(0x%02X + cnt)", k);
+	else
+		printf("(uint8_t)(%d - cnt)", k < hi ? k + 256 : k);
+}
+
+static void rle8_generate_decompress(struct rle_parser *p) {
+	struct rle8_range ranges[256];
+	size_t n = rle8_find_ranges(p, ranges);
+
+	printf("ssize_t %s_gen_decompress(const uint8_t *src, size_t slen, uint8_t *dest, size_t dlen) {\n", p->name);
+	printf("\tsize_t wp = 0;\n");
+	printf("\tsize_t rp = 0;\n");
+	printf("\twhile (rp < slen) {\n");
+	printf("\t\tsize_t cnt;\n");
+	printf("\t\tuint8_t b = src[rp++];\n");
+	for (size_t i = 0 ; i < n ; ++i) {
+		const struct rle8_range *r = &ranges[i];
+		if (n == 1)
+			printf("\t\t{\n");
+		else if (i == 0)
+			printf("\t\tif (b <= 0x%02X) {\n", r->hi);
+		else if (i + 1 < n && r->lo == r->hi)
+			printf("\t\t} else if (b == 0x%02X) {\n", r->hi);
+		else if (i + 1 < n)
+			printf("\t\t} else if (b <= 0x%02X) {\n", r->hi);
+		else
+			printf("\t\t} else {\n");
+
+		printf("\t\t\t// %s\n", rle_op_cstr(r->op));
+		switch (r->op) {
+			case RLE_OP_CPY:
+				printf("\t\t\tcnt = "); rle8_print_count(r); printf(";\n");
+				printf("\t\t\tif (cnt > slen - rp) {\n\t\t\t\tRLE_ZOO_RETURN_ERR;\n\t\t\t}\n");
+				printf("\t\t\tif (dest) {\n\t\t\t\tif (cnt > dlen - wp) {\n\t\t\t\t\tRLE_ZOO_RETURN_ERR;\n\t\t\t\t}\n");
+				printf("\t\t\t\tmemcpy(dest + wp, src + rp, cnt);\n\t\t\t}\n");
+				printf("\t\t\trp += cnt;\n");
+				break;
+			case RLE_OP_REP:
+				printf("\t\t\tcnt = "); rle8_print_count(r); printf(";\n");
+				printf("\t\t\tif (!(rp < slen)) {\n\t\t\t\tRLE_ZOO_RETURN_ERR;\n\t\t\t}\n");
+				printf("\t\t\tif (dest) {\n\t\t\t\tif (cnt > dlen - wp) {\n\t\t\t\t\tRLE_ZOO_RETURN_ERR;\n\t\t\t\t}\n");
+				printf("\t\t\t\tmemset(dest + wp, src[rp], cnt);\n\t\t\t}\n");
+				printf("\t\t\t++rp;\n");
+				break;
+			case RLE_OP_LIT:
+				printf("\t\t\tcnt = 1;\n");
+				printf("\t\t\tif (dest) {\n\t\t\t\tif (!(wp < dlen)) {\n\t\t\t\t\tRLE_ZOO_RETURN_ERR;\n\t\t\t\t}\n");
+				printf("\t\t\t\tdest[wp] = b;\n\t\t\t}\n");
+				break;
+			case RLE_OP_NOP:
+				printf("\t\t\tcnt = 0;\n");
+				break;
+			case RLE_OP_INVALID:
+				printf("\t\t\tRLE_ZOO_RETURN_ERR;\n");
+				break;
+		}
+	}
+	printf("\t\t}\n");
+	printf("\t\twp += cnt;\n");
+	printf("\t}\n");
+	printf("\tassert(rp == slen);\n");
+	printf("\tassert((dest == NULL) || (wp <= dlen));\n");
+	printf("\treturn (ssize_t)wp;\n");
+	printf("}\n");
+}
+
+static void rle8_generate_compress(struct rle_parser *p) {
+	const struct rle8_policy *pol = &p->policy;
+	int minmax[RLE_OP_INVALID][2] = { { INT_MAX, INT_MIN }, { INT_MAX, INT_MIN }, { INT_MAX, INT_MIN } };
+	int lit_max = -1;
+
+	for (int i=0 ; i < 256 ; ++i) {
+		struct rle8 cmd = p->rle8_decode(i);
+		if (rle8_is_counted(cmd.op)) {
+			if (cmd.cnt < minmax[cmd.op][0])
+				minmax[cmd.op][0] = cmd.cnt;
+			if (cmd.cnt > minmax[cmd.op][1])
+				minmax[cmd.op][1] = cmd.cnt;
+		} else if (cmd.op == RLE_OP_LIT) {
+			lit_max = i;
+		}
+	}
+	const int max_rep = minmax[RLE_OP_REP][1];
+	const int max_cpy = minmax[RLE_OP_CPY][1];
+	assert(max_rep > 0 && (max_cpy > 0 || lit_max >= 0));
+
+	printf("// RLE PARAMS: ");
+	if (max_cpy > 0)
+		printf("min CPY=%d, max CPY=%d, ", minmax[RLE_OP_CPY][0], max_cpy);
+	else
+		printf("LIT=0x00-0x%02X, ", lit_max);
+	printf("min REP=%d, max REP=%d\n", minmax[RLE_OP_REP][0], max_rep);
+
+	printf("ssize_t %s_gen_compress(const uint8_t *src, size_t slen, uint8_t *dest, size_t dlen) {\n", p->name);
+	printf("\tsize_t rp = 0;\n");
+	printf("\tsize_t wp = 0;\n");
+	printf("\n");
+	printf("\twhile (rp < slen) {\n");
+	printf("\t\tsize_t cnt = 1;\n");
+	printf("\t\twhile (rp + cnt < slen && cnt < %d && src[rp + cnt] == src[rp]) {\n", max_rep);
+	printf("\t\t\t++cnt;\n");
+	printf("\t\t}\n");
+	printf("\n");
+
+	printf("\t\t// REP\n");
+	printf("\t\tif (cnt >= %d", pol->min_rep);
+	if (pol->rep_last)
+		printf(" || rp + cnt == slen");
+	if (max_cpy <= 0)
+		printf(" || src[rp] > 0x%02X", lit_max);
+	printf(") {\n");
+	printf("\t\t\tif (dest) {\n\t\t\t\tif (2 > dlen - wp) {\n\t\t\t\t\tRLE_ZOO_RETURN_ERR;\n\t\t\t\t}\n");
+	printf("\t\t\t\tdest[wp + 0] = "); rle8_print_code(p, RLE_OP_REP, minmax[RLE_OP_REP][0], max_rep); printf(";\n");
+	printf("\t\t\t\tdest[wp + 1] = src[rp];\n\t\t\t}\n");
+	printf("\t\t\twp += 2;\n");
+	printf("\t\t\trp += cnt;\n");
+	printf("\t\t\tcontinue;\n");
+	printf("\t\t}\n");
+	printf("\n");
+
+	if (max_cpy <= 0) {
+		printf("\t\t// LIT\n");
+		printf("\t\tif (dest) {\n\t\t\tif (!(wp < dlen)) {\n\t\t\t\tRLE_ZOO_RETURN_ERR;\n\t\t\t}\n");
+		printf("\t\t\tdest[wp] = src[rp];\n\t\t}\n");
+		printf("\t\t++wp;\n");
+		printf("\t\t++rp;\n");
+	} else {
+		printf("\t\t// CPY\n");
+		if (pol->cpy_lookback) {
+			printf("\t\tsize_t same = 0;\n");
+			printf("\t\tcnt = 1;\n");
+			printf("\t\twhile (rp + cnt < slen && cnt < %d) {\n", max_cpy);
+			printf("\t\t\tif (src[rp + cnt - 1] != src[rp + cnt]) {\n");
+			printf("\t\t\t\tsame = 0;\n");
+			printf("\t\t\t} else if (++same == %d) {\n", pol->min_rep - 1);
+			printf("\t\t\t\tcnt -= %d;\n", pol->min_rep - 1);
+			printf("\t\t\t\tbreak;\n");
+			printf("\t\t\t}\n");
+			printf("\t\t\t++cnt;\n");
+			printf("\t\t}\n");
+		} else {
+			printf("\t\tcnt = 0;\n");
+			printf("\t\twhile (rp + cnt + 1 < slen && cnt < %d && src[rp + cnt] != src[rp + cnt + 1]) {\n", max_cpy);
+			printf("\t\t\t++cnt;\n");
+			printf("\t\t}\n");
+			if (pol->cpy_last) {
+				printf("\t\tif (rp + cnt + 1 == slen && cnt < %d) {\n", max_cpy);
+				printf("\t\t\t++cnt;\n");
+				printf("\t\t}\n");
+			}
+		}
+		printf("\t\tassert(cnt > 0 && rp + cnt <= slen);\n");
+		printf("\t\tif (dest) {\n\t\t\tif (cnt + 1 > dlen - wp) {\n\t\t\t\tRLE_ZOO_RETURN_ERR;\n\t\t\t}\n");
+		printf("\t\t\tdest[wp] = "); rle8_print_code(p, RLE_OP_CPY, minmax[RLE_OP_CPY][0], max_cpy); printf(";\n");
+		printf("\t\t\tmemcpy(dest + wp + 1, src + rp, cnt);\n\t\t}\n");
+		printf("\t\twp += cnt + 1;\n");
+		printf("\t\trp += cnt;\n");
+	}
+	printf("\t}\n");
+	printf("\tassert(rp == slen);\n");
+	printf("\tassert((dest == NULL) || (wp <= dlen));\n");
+	printf("\treturn (ssize_t)wp;\n");
+	printf("}\n");
+}
+
+// Generate a single-header library with the codec of the variant, specialized from its op tables.
+static void rle8_generate_c_codec(struct rle_parser *p) {
+	char upper[64];
+	size_t i;
+	for (i = 0 ; p->name[i] && i < sizeof(upper) - 1 ; ++i)
+		upper[i] = (p->name[i] >= 'a' && p->name[i] <= 'z') ? p->name[i] - 'a' + 'A' : p->name[i];
+	upper[i] = 0;
+
+	printf("%s", gen_header);
+	printf("\n// Codec for RLE8 variant '%s'\n", p->name);
+	printf("#ifdef __cplusplus\nextern \"C\" {\n#endif\n\n");
+	printf("#include <stdint.h>\n#include <stddef.h>\n");
+	printf("#if defined(_MSC_VER)\n#include <BaseTsd.h>\ntypedef SSIZE_T ssize_t;\n#else\n#include <sys/types.h> // ssize_t\n#endif\n\n");
+	printf("ssize_t %s_gen_compress(const uint8_t *src, size_t slen, uint8_t *dest, size_t dlen);\n", p->name);
+	printf("ssize_t %s_gen_decompress(const uint8_t *src, size_t slen, uint8_t *dest, size_t dlen);\n\n", p->name);
+	printf("#if defined(RLE_ZOO_GEN_%s_IMPLEMENTATION) || defined(RLE_ZOO_IMPLEMENTATION)\n", upper);
+	printf("#include <assert.h>\n#include <string.h>\n\n");
+	printf("static_assert(sizeof(size_t) == sizeof(ssize_t), \"\");\n\n");
+	printf("// return -(rp + 1) ... mask so it can't flip positive.\n");
+	printf("#define RLE_ZOO_RETURN_ERR return ~(rp & ((size_t)~0 >> 1UL))\n\n");
+	rle8_generate_compress(p);
+	printf("\n");
+	rle8_generate_decompress(p);
+	printf("#undef RLE_ZOO_RETURN_ERR\n#endif\n\n");
+	printf("#ifdef __cplusplus\n}\n#endif\n");
+}
+
+// CRC32C, as used by the test suites.
+static uint32_t crc32c(const uint8_t *data, size_t len) {
+	uint32_t crc = ~0U;
+	for (size_t i = 0 ; i < len ; ++i) {
+		crc ^= data[i];
+		for (int k = 0 ; k < 8 ; ++k)
+			crc = (crc >> 1) ^ (0x82F63B78 & (0U - (crc & 1)));
+	}
+	return ~crc;
+}
+
+// Encode `src` following the policy of the variant, the same way as the generated codec.
+static size_t rle8_policy_encode(struct rle_parser *p, const uint8_t *src, size_t slen, uint8_t *dest) {
+	const struct rle8_policy *pol = &p->policy;
+	int max_rep = 0;
+	int max_cpy = 0;
+	for (int i=0 ; i < 256 ; ++i) {
+		struct rle8 cmd = p->rle8_decode(i);
+		if (cmd.op == RLE_OP_REP && cmd.cnt > max_rep)
+			max_rep = cmd.cnt;
+		if (cmd.op == RLE_OP_CPY && cmd.cnt > max_cpy)
+			max_cpy = cmd.cnt;
+	}
+
+	size_t rp = 0;
+	size_t wp = 0;
+	while (rp < slen) {
+		size_t cnt = 1;
+		while (rp + cnt < slen && cnt < (size_t)max_rep && src[rp + cnt] == src[rp])
+			++cnt;
+
+		if (cnt >= (size_t)pol->min_rep || (pol->rep_last && rp + cnt == slen) || (max_cpy == 0 && p->rle8_decode(src[rp]).op != RLE_OP_LIT)) {
+			dest[wp++] = p->rle8_encode((struct rle8){ RLE_OP_REP, cnt }).cnt;
+			dest[wp++] = src[rp];
+			rp += cnt;
+			continue;
+		}
+
+		if (max_cpy == 0) {
+			dest[wp++] = src[rp++];
+			continue;
+		}
+
+		if (pol->cpy_lookback) {
+			size_t same = 0;
+			cnt = 1;
+			while (rp + cnt < slen && cnt < (size_t)max_cpy) {
+				if (src[rp + cnt - 1] != src[rp + cnt]) {
+					same = 0;
+				} else if (++same == (size_t)pol->min_rep - 1) {
+					cnt -= pol->min_rep - 1;
+					break;
+				}
+				++cnt;
+			}
+		} else {
+			cnt = 0;
+			while (rp + cnt + 1 < slen && cnt < (size_t)max_cpy && src[rp + cnt] != src[rp + cnt + 1])
+				++cnt;
+			if (pol->cpy_last && rp + cnt + 1 == slen && cnt < (size_t)max_cpy)
+				++cnt;
+		}
+		dest[wp++] = p->rle8_encode((struct rle8){ RLE_OP_CPY, cnt }).cnt;
+		memcpy(dest + wp, src + rp, cnt);
+		wp += cnt;
+		rp += cnt;
+	}
+	return wp;
+}
+
+static void rle8_print_vector(const uint8_t *data, size_t len) {
+	printf("\"");
+	for (size_t i = 0 ; i < len ; ++i) {
+		if ((data[i] >= 'A' && data[i] <= 'Z') || (data[i] >= 'a' && data[i] <= 'z') || (data[i] >= '0' && data[i] <= '9'))
+			printf("%c", data[i]);
+		else
+			printf("\\x%02X", data[i]);
+	}
+	printf("\"");
+}
+
+// Generate a test suite for the variant: compress edge cases, decompress them back, and truncated input.
+static void rle8_generate_tests(struct rle_parser *p) {
+	int max_rep = 0;
+	int max_cpy = 0;
+	int rep_code = -1;
+	int cpy_code = -1;
+	for (int i=0 ; i < 256 ; ++i) {
+		struct rle8 cmd = p->rle8_decode(i);
+		if (cmd.op == RLE_OP_REP && cmd.cnt > max_rep) {
+			max_rep = cmd.cnt;
+			rep_code = i;
+		}
+		if (cmd.op == RLE_OP_CPY && cmd.cnt > max_cpy) {
+			max_cpy = cmd.cnt;
+			cpy_code = i;
+		}
+	}
+	const size_t cpy_len = max_cpy > 0 ? (size_t)max_cpy : 64;
+	const size_t min_rep = (size_t)p->policy.min_rep;
+
+	enum { MAX_VECTOR = 512 };
+	struct { uint8_t data[MAX_VECTOR]; size_t len; } vec[12];
+	size_t nvec = 0;
+	uint8_t out[2 * MAX_VECTOR + 2];
+
+#define ADD_RUNS(...) do { \
+		const size_t runs[] = { __VA_ARGS__ }; \
+		size_t len = 0; \
+		for (size_t r = 0 ; r < sizeof(runs)/sizeof(runs[0]) ; ++r) { \
+			for (size_t k = 0 ; k < runs[r] ; ++k) \
+				vec[nvec].data[len++] = (uint8_t)('A' + r % 26); \
+		} \
+		vec[nvec++].len = len; \
+	} while (0)
+
+	ADD_RUNS(0);
+	ADD_RUNS(1);
+	ADD_RUNS(1, 1);
+	ADD_RUNS(min_rep);
+	ADD_RUNS(min_rep - 1, 1, min_rep, 1, min_rep + 1);
+	ADD_RUNS((size_t)max_rep);
+	ADD_RUNS((size_t)max_rep + 1);
+	ADD_RUNS(1, (size_t)max_rep + min_rep, 1);
+#undef ADD_RUNS
+	// Distinct bytes, at the CPY limit and past it, and all byte values.
+	for (size_t extra = 0 ; extra < 2 ; ++extra) {
+		for (size_t k = 0 ; k < cpy_len + extra ; ++k)
+			vec[nvec].data[k] = (uint8_t)('A' + k % 26);
+		vec[nvec++].len = cpy_len + extra;
+	}
+	for (size_t k = 0 ; k < 256 ; ++k)
+		vec[nvec].data[k] = (uint8_t)(255 - k);
+	vec[nvec++].len = 256;
+
+	printf("#\n# Test vectors for variant '%s', generated by rle-genops\n#\n", p->name);
+	for (size_t i = 0 ; i < nvec ; ++i) {
+		size_t olen = rle8_policy_encode(p, vec[i].data, vec[i].len, out);
+		printf("%s c ", p->name);
+		rle8_print_vector(vec[i].data, vec[i].len);
+		printf(" %zu 0x%08x\n", olen, olen ? crc32c(out, olen) : 0);
+		if (vec[i].len > 0) {
+			printf("%s d ", p->name);
+			rle8_print_vector(out, olen);
+			printf(" %zu 0x%08x\n", vec[i].len, crc32c(vec[i].data, vec[i].len));
+		}
+	}
+
+	printf("\n## Invalid input examples:\n");
+	if (rep_code >= 0) {
+		printf("## Truncated REP\n");
+		printf("%s d \"\\x%02X\" -2\n", p->name, rep_code);
+	}
+	if (cpy_code >= 0) {
+		printf("## Truncated CPY\n");
+		printf("%s d \"\\x%02XA\" -2\n", p->name, cpy_code);
+	}
+}
+
+// Variant loaded from a spec file by rle8_load_spec(), with its decode table filled in from the op ranges.
+static struct rle8 spec_decode_tbl[256];
+static char spec_name[64];
+
+static struct rle8 rle8_decode_spec(uint8_t input) {
+	return spec_decode_tbl[input];
+}
+
+static struct rle8 rle8_encode_spec(struct rle8 cmd) {
+	struct rle8 res = { RLE_OP_INVALID, 0 };
+
+	for (int i=0 ; i < 256 ; ++i) {
+		if (spec_decode_tbl[i].op == cmd.op && (cmd.op == RLE_OP_NOP || spec_decode_tbl[i].cnt == cmd.cnt)) {
+			res.op = cmd.op;
+			res.cnt = i;
+			break;
+		}
+	}
+
+	return res;
+}
+
+// Returns the op named by `str` in lower case, e.g "rep", or RLE_OP_INVALID.
+static enum RLE_OP rle8_op_from_cstr(const char *str) {
+	char upper[8] = { 0 };
+	for (size_t i = 0 ; str[i] && i < sizeof(upper) - 1 ; ++i)
+		upper[i] = (str[i] >= 'a' && str[i] <= 'z') ? str[i] - 'a' + 'A' : str[i];
+	for (int op = RLE_OP_CPY ; op < RLE_OP_INVALID ; ++op) {
+		if (strcmp(upper, rle_op_cstr(op)) == 0)
+			return op;
+	}
+	return RLE_OP_INVALID;
+}
+
+// Returns non-zero if `str` is a valid C identifier.
+static int rle8_is_identifier(const char *str) {
+	if (!((*str >= 'a' && *str <= 'z') || (*str >= 'A' && *str <= 'Z') || *str == '_'))
+		return 0;
+	for (++str ; *str ; ++str) {
+		if (!((*str >= 'a' && *str <= 'z') || (*str >= 'A' && *str <= 'Z') || (*str >= '0' && *str <= '9') || *str == '_'))
+			return 0;
+	}
+	return 1;
+}
+
+#define SPEC_ERROR(fmt, ...) \
+	do { fprintf(stderr, "%s:%zu: error: " fmt "\n", filename, line_no __VA_OPT__(,) __VA_ARGS__); exit(1); } while (0)
+
+/*
+	Load a variant from a spec file, e.g:
+
+		variant packbits
+		cpy 0x00-0x7F 1
+		nop 0x80
+		rep 0x81-0xFF 128 -1
+		min-rep 2
+		cpy-last
+
+	An op line gives the op, a range of codes, the count of the first code, and how much
+	the count changes from one code to the next (default +1). A LIT code is its own output,
+	and so has no count. Codes not covered by any op are invalid. The remaining lines set
+	the encoder policy; see struct rle8_policy.
+*/
+static struct rle_parser* rle8_load_spec(const char *filename) {
+	static struct rle_parser spec_parser;
+	struct rle8_policy policy = { 0 };
+	int used[256] = { 0 };
+	int max_rep = 0;
+	char line[256];
+	size_t line_no = 0;
+
+	FILE *f = fopen(filename, "r");
+	if (!f) {
+		fprintf(stderr, "error: Could not open spec '%s'\n", filename);
+		exit(1);
+	}
+
+	for (int i=0 ; i < 256 ; ++i)
+		spec_decode_tbl[i] = (struct rle8){ RLE_OP_INVALID, 0 };
+	spec_name[0] = 0;
+
+	while (fgets(line, sizeof(line), f)) {
+		++line_no;
+		char *comment = strchr(line, '#');
+		if (comment)
+			*comment = 0;
+
+		char key[32];
+		char arg[64];
+		int cnt = 0;
+		int step = 1;
+		int n = sscanf(line, "%31s %63s %i %i", key, arg, &cnt, &step);
+		if (n < 1)
+			continue;
+
+		if (strcmp(key, "variant") == 0) {
+			// The name is pasted into identifiers by --genc and --gencodec.
+			if (n < 2 || strlen(arg) >= sizeof(spec_name) || !rle8_is_identifier(arg))
+				SPEC_ERROR("invalid variant name '%s'", n < 2 ? "" : arg);
+			strcpy(spec_name, arg);
+		} else if (strcmp(key, "min-rep") == 0) {
+			if (n < 2 || (policy.min_rep = (int)strtol(arg, NULL, 0)) < 1)
+				SPEC_ERROR("invalid min-rep");
+		} else if (strcmp(key, "rep-last") == 0) {
+			policy.rep_last = 1;
+		} else if (strcmp(key, "cpy-last") == 0) {
+			policy.cpy_last = 1;
+		} else if (strcmp(key, "cpy-lookback") == 0) {
+			policy.cpy_lookback = 1;
+		} else {
+			enum RLE_OP op = rle8_op_from_cstr(key);
+			if (op == RLE_OP_INVALID)
+				SPEC_ERROR("unknown key '%s'", key);
+			if (n < 2)
+				SPEC_ERROR("missing code range");
+
+			char *end;
+			long lo = strtol(arg, &end, 0);
+			long hi = *end == '-' ? strtol(end + 1, &end, 0) : lo;
+			if (*end != 0 || lo < 0 || hi > 255 || lo > hi)
+				SPEC_ERROR("invalid code range '%s'", arg);
+			if (rle8_is_counted(op) && n < 3)
+				SPEC_ERROR("missing count for %s", key);
+			if (op == RLE_OP_NOP)
+				cnt = 1;
+
+			for (long b = lo ; b <= hi ; ++b) {
+				int c = op == RLE_OP_LIT ? (int)b : cnt + step * (int)(b - lo);
+				if (used[b])
+					SPEC_ERROR("code 0x%02lx is already used", b);
+				if (c < 0 || c > 255)
+					SPEC_ERROR("count %d of code 0x%02lx out of range", c, b);
+				used[b] = 1;
+				spec_decode_tbl[b] = (struct rle8){ op, (uint8_t)c };
+				if (op == RLE_OP_REP && c > max_rep)
+					max_rep = c;
+			}
+		}
+	}
+	fclose(f);
+
+	if (spec_name[0] == 0)
+		SPEC_ERROR("no variant name given");
+	if (policy.min_rep == 0)
+		SPEC_ERROR("no min-rep given");
+	// The encoders emit a REP for every run of `min-rep` or more.
+	if (max_rep == 0)
+		SPEC_ERROR("no rep with a count given");
+	if (policy.min_rep > max_rep)
+		SPEC_ERROR("min-rep %d is larger than the largest rep count %d", policy.min_rep, max_rep);
+
+	// Every op must have a unique code, or it can't be encoded.
+	for (int i=0 ; i < 256 ; ++i) {
+		struct rle8 cmd = spec_decode_tbl[i];
+		if (cmd.op != RLE_OP_INVALID && rle8_encode_spec(cmd).cnt != i) {
+			line_no = 0;
+			SPEC_ERROR("%s %d has more than one code", rle_op_cstr(cmd.op), cmd.cnt);
+		}
+	}
+
+	spec_parser = (struct rle_parser){ spec_name, rle8_encode_spec, rle8_decode_spec, policy };
+	return &spec_parser;
+}
+#undef SPEC_ERROR
+
 struct rle_parser parsers[] = {
 	{
 		"goldbox",
 		rle8_encode_goldbox,
-		rle8_decode_goldbox
+		rle8_decode_goldbox,
+		{ .min_rep = 2, .rep_last = 1 }
 	},
 	{
 		"packbits",
 		rle8_encode_packbits,
-		rle8_decode_packbits
+		rle8_decode_packbits,
+		{ .min_rep = 2, .cpy_last = 1 }
 	},
 	{
 		"pcx",
 		rle8_encode_pcx,
-		rle8_decode_pcx
+		rle8_decode_pcx,
+		{ .min_rep = 2 }
 	},
 	{
 		"icns",
 		rle8_encode_icns,
-		rle8_decode_icns
+		rle8_decode_icns,
+		{ .min_rep = 3, .cpy_last = 1, .cpy_lookback = 1 }
 	}
 };
 static const size_t NUM_VARIANTS = sizeof(parsers)/sizeof(parsers[0]);
@@ -385,10 +1091,14 @@ static void print_variants(void) {
 
 static void usage(const char *argv) {
 	print_banner();
-	printf("%s [OPTION] <variant>\n\n", argv);
+	printf("%s [OPTION] <variant>\n", argv);
+	printf("%s [OPTION] --spec <file>\n\n", argv);
 
 	printf("Options:\n");
 	printf("  --genc - Generate C tables.\n");
+	printf("  --gencodec - Generate C source for the compress and decompress functions.\n");
+	printf("  --gentests - Generate a test suite.\n");
+	printf("  --spec <file> - Load the variant from a spec file.\n");
 
 	print_variants();
 }
@@ -418,6 +1128,13 @@ static int parse_args(int *argc, char ***argv) {
 					opt_usage = 1;
 				} else if (strcmp(arg, "genc") == 0) {
 					opt_genc = 1;
+				} else if (strcmp(arg, "gencodec") == 0) {
+					opt_gencodec = 1;
+				} else if (strcmp(arg, "gentests") == 0) {
+					opt_gentests = 1;
+				} else if (strcmp(arg, "spec") == 0 && *l_argv) {
+					opt_spec = *l_argv++;
+					--l_argc;
 				} else {
 					retval = 1;
 					break;
@@ -463,7 +1180,11 @@ int main(int argc, char *argv[]) {
 	}
 
 	char *variant = argv[0];
-	struct rle_parser *p = argc > 0 ? get_parser_by_name(variant) : NULL;
+	struct rle_parser *p = NULL;
+	if (opt_spec)
+		p = rle8_load_spec(opt_spec);
+	else if (argc > 0)
+		p = get_parser_by_name(variant);
 
 	if (!p) {
 		if (variant) {
@@ -475,7 +1196,11 @@ int main(int argc, char *argv[]) {
 		return 2;
 	}
 
-	if (opt_genc)
+	if (opt_gentests)
+		rle8_generate_tests(p);
+	else if (opt_gencodec)
+		rle8_generate_c_codec(p);
+	else if (opt_genc)
 		rle8_generate_c_tables(p);
 	else
 		rle8_display_ops(p);
@@ -3,9 +3,7 @@
 	Copyright (c) 2022, Eddy L O Jansson. Licensed under The MIT License.
 
 	TODO:
-		The parser is incomplete and not fully functional.
-		'goldbox' encoding is broken -- always uses REP due to min-rep==1
-		Add support for LIT.
+		parse_rle() is superseded by rle8_tbl_next_op(), and is kept for its tests.
 
 	See https://github.com/eloj/rle-zoo
 */
@@ -13,6 +11,15 @@
 extern "C" {
 #endif
 
+#include <stdint.h>
+#include <stddef.h>
+#if defined(_MSC_VER)
+#include <BaseTsd.h>
+typedef SSIZE_T ssize_t;
+#else
+#include <sys/types.h> // ssize_t
+#endif
+
 // NOTE: The order and value of these matter.
 enum RLE_OP {
 	RLE_OP_CPY,
@@ -27,11 +34,35 @@ struct rle8 {
 	uint8_t cnt; // TODO: rename to 'arg'?
 };
 
+// How to execute an op, expressed so that every kind of op is executed the same way:
+// output `cnt` bytes from `src` bytes past the op byte, stepping `stride` (0 or 1) bytes
+// per output byte, then advance the input by `len` bytes.
+struct rle8_step {
+	uint8_t op;	// The enum RLE_OP, for reference; the decoder never looks at it.
+	uint8_t src;
+	uint8_t stride;
+	uint16_t cnt;
+	uint16_t len;	// Zero for invalid ops.
+};
+
+// Tables for decoding several short ops per step with 16 byte vector shuffles, generated by rle-genops.
+// Ops whose input and output both fit within a vector are short, and are executed by one shuffle of
+// the 16 input bytes starting at the op byte. Runs of LITs are copied up to a vector at a time.
+struct rle8_simd {
+	uint8_t shuf[256][16];	// Output byte offsets into the input, 0x80 past the count of the op.
+	uint8_t inlen[256];	// Input length of short ops, zero for other ops.
+	uint8_t outlen[256];
+	uint8_t lit_lo[16];	// Op byte `b` is a LIT if `lit_lo[b & 15] & lit_hi[b >> 4]` is non-zero.
+	uint8_t lit_hi[16];
+};
+
 struct rle8_tbl {
 	const char *name;
 	enum RLE_OP op_used;
 	const int16_t *encode_tbl[3];
 	const struct rle8 *decode_tbl;
+	const struct rle8_step *step_tbl;
+	const struct rle8_simd *simd_tbl;
 	const size_t minmax_op[3][2];
 };
 
@@ -48,7 +79,19 @@ struct rle8 parse_rle(const uint8_t *in, size_t len, const struct rle8_params *p
 size_t rle_count_rep(const uint8_t* src, size_t len, size_t max);
 size_t rle_count_cpy(const uint8_t* src, size_t len, size_t max);
 
+struct rle8_step rle8_step_from_op(struct rle8 cmd);
+void rle8_tbl_build_steps(const struct rle8 *decode_tbl, struct rle8_step *steps);
+ssize_t rle8_tbl_decompress(const struct rle8_tbl *rle, const uint8_t *src, size_t slen, uint8_t *dest, size_t dlen);
+struct rle8 rle8_tbl_next_op(const struct rle8_tbl *rle, const uint8_t *src, size_t len);
+ssize_t rle8_tbl_compress(const struct rle8_tbl *rle, const uint8_t *src, size_t slen, uint8_t *dest, size_t dlen);
+
 #ifdef RLE_PARSE_IMPLEMENTATION
+#include <assert.h>
+#include <string.h>
+#if defined(__SSSE3__)
+#include <tmmintrin.h>
+#define RLE_PARSE_SSSE3
+#endif
 
 const char *rle_op_cstr(enum RLE_OP op) {
 	const char *res = "UNKNOWN";
@@ -150,6 +193,284 @@ size_t rle_count_cpy(const uint8_t* src, size_t len, size_t max) {
 	return cnt;
 }
 
+// Returns how to execute `cmd`, as decoded from an op byte.
+struct rle8_step rle8_step_from_op(struct rle8 cmd) {
+	struct rle8_step step = { cmd.op, 0, 0, 0, 0 };
+
+	switch (cmd.op) {
+		case RLE_OP_CPY:
+			// Copy the bytes following the op byte.
+			step.src = 1;
+			step.stride = 1;
+			step.cnt = cmd.cnt;
+			step.len = 1 + cmd.cnt;
+			break;
+		case RLE_OP_REP:
+			// Repeat the byte following the op byte.
+			step.src = 1;
+			step.cnt = cmd.cnt;
+			step.len = 2;
+			break;
+		case RLE_OP_LIT:
+			// The op byte is the output.
+			step.cnt = 1;
+			step.len = 1;
+			break;
+		case RLE_OP_NOP:
+			step.len = 1;
+			break;
+		case RLE_OP_INVALID:
+			break;
+	}
+
+	return step;
+}
+
+// Fill in the 256 entry step table `steps` for the decode table `decode_tbl`.
+void rle8_tbl_build_steps(const struct rle8 *decode_tbl, struct rle8_step *steps) {
+	for (size_t i = 0 ; i < 256 ; ++i) {
+		steps[i] = rle8_step_from_op(decode_tbl[i]);
+	}
+}
+
+// Input and output the fast path of rle8_tbl_decompress() must have left to not need bounds checks.
+// An op is at most 2 + 255 bytes long, and is written in whole words, with at least two words per op.
+#define RLE8_STEP_SLACK (256 + 32)
+
+static inline uint64_t rle8_load64(const uint8_t *p) {
+	uint64_t v;
+	memcpy(&v, p, sizeof(v));
+	return v;
+}
+
+// Execute the op at `src` into `dest`, in whole words, overwriting up to 16 bytes past the output.
+static inline void rle8_step_exec(const struct rle8_step *s, const uint8_t *src, uint8_t *dest) {
+	const uint8_t *from = src + s->src;
+	// All ones to copy, all zeroes to repeat the first byte.
+	const uint64_t mask = (uint64_t)0 - s->stride;
+	const uint64_t fill = from[0] * (uint64_t)0x0101010101010101;
+	// Short ops are the common case, so always write two words, which makes them branch-free.
+	for (size_t k = 0 ; k < 16 ; k += 8) {
+		uint64_t v = (rle8_load64(from + (k & mask)) & mask) | (fill & ~mask);
+		memcpy(dest + k, &v, sizeof(v));
+	}
+	for (size_t k = 16 ; k < s->cnt ; k += 8) {
+		uint64_t v = (rle8_load64(from + (k & mask)) & mask) | (fill & ~mask);
+		memcpy(dest + k, &v, sizeof(v));
+	}
+}
+
+// return -(rp + 1) ... mask so it can't flip positive. Give up and just always return -1?
+#define RLE_ZOO_RETURN_ERR return ~(rp & ((size_t)~0 >> 1UL))
+
+// Decompress `src` with any table-described variant, using its step table, or if it has none, one
+// built from its decode table. Errors are reported as by the hand-written decoders, as -(offset + 1)
+// of the byte following the failing op byte.
+// Bytes of `dest` past the returned length, up to `dlen`, may be overwritten.
+ssize_t rle8_tbl_decompress(const struct rle8_tbl *rle, const uint8_t *src, size_t slen, uint8_t *dest, size_t dlen) {
+	const struct rle8_step *steps = rle->step_tbl;
+	struct rle8_step built[256];
+	size_t rp = 0;
+	size_t wp = 0;
+
+	if (!steps) {
+		rle8_tbl_build_steps(rle->decode_tbl, built);
+		steps = built;
+	}
+
+#if defined(RLE_PARSE_SSSE3)
+	// Vector fast path; copy runs of LITs up to a vector at a time, and execute other short ops with
+	// a single shuffle. Long ops are executed as below, and anything else is left to the checked loop.
+	const struct rle8_simd *simd = rle->simd_tbl;
+	if (simd && dest && slen >= RLE8_STEP_SLACK && dlen >= RLE8_STEP_SLACK) {
+		const __m128i lit_lo = _mm_loadu_si128((const __m128i *)simd->lit_lo);
+		const __m128i lit_hi = _mm_loadu_si128((const __m128i *)simd->lit_hi);
+		const __m128i nibble = _mm_set1_epi8(0x0F);
+		while (rp <= slen - RLE8_STEP_SLACK && wp <= dlen - RLE8_STEP_SLACK) {
+			const uint8_t b = src[rp];
+			if (simd->inlen[b] == 0) {
+				const struct rle8_step *s = &steps[b];
+				if (s->len == 0)
+					break;
+				rle8_step_exec(s, src + rp, dest + wp);
+				rp += s->len;
+				wp += s->cnt;
+				continue;
+			}
+			const __m128i in = _mm_loadu_si128((const __m128i *)(src + rp));
+			// Single LITs are cheaper to execute as any other short op, so only look for a run if the next op
+			// is a LIT too. This misses pairs of LITs in different classes, which are then executed one by one.
+			const uint8_t b1 = src[rp + 1];
+			if (simd->lit_lo[b & 15] & simd->lit_hi[b >> 4] & simd->lit_lo[b1 & 15] & simd->lit_hi[b1 >> 4]) {
+				const __m128i lo = _mm_shuffle_epi8(lit_lo, _mm_and_si128(in, nibble));
+				const __m128i hi = _mm_shuffle_epi8(lit_hi, _mm_and_si128(_mm_srli_epi16(in, 4), nibble));
+				const unsigned int not_lit = (unsigned int)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(lo, hi), _mm_setzero_si128()));
+				// The count of leading LITs; bit 16 stops a vector of all LITs.
+				const unsigned int nlit = (unsigned int)__builtin_ctz(not_lit | 0x10000);
+				_mm_storeu_si128((__m128i *)(dest + wp), in);
+				rp += nlit;
+				wp += nlit;
+				continue;
+			}
+			const __m128i shuf = _mm_loadu_si128((const __m128i *)simd->shuf[b]);
+			_mm_storeu_si128((__m128i *)(dest + wp), _mm_shuffle_epi8(in, shuf));
+			rp += simd->inlen[b];
+			wp += simd->outlen[b];
+		}
+	}
+#endif
+
+	// Fast path; while far enough from either end, execute ops without checking what kind they are.
+	if (dest && slen >= RLE8_STEP_SLACK && dlen >= RLE8_STEP_SLACK) {
+		while (rp <= slen - RLE8_STEP_SLACK && wp <= dlen - RLE8_STEP_SLACK) {
+			const struct rle8_step *s = &steps[src[rp]];
+			if (s->len == 0)
+				break;
+			rle8_step_exec(s, src + rp, dest + wp);
+			rp += s->len;
+			wp += s->cnt;
+		}
+	}
+
+	while (rp < slen) {
+		assert((ssize_t)wp >= 0);
+		assert((ssize_t)rp >= 0);
+
+		const struct rle8_step *s = &steps[src[rp]];
+		if (s->len == 0 || s->len > slen - rp) {
+			++rp;
+			RLE_ZOO_RETURN_ERR;
+		}
+		if (dest) {
+			if (s->cnt > dlen - wp) {
+				++rp;
+				RLE_ZOO_RETURN_ERR;
+			}
+			const uint8_t *from = src + rp + s->src;
+			for (size_t k = 0 ; k < s->cnt ; ++k)
+				dest[wp + k] = from[k * s->stride];
+		}
+		rp += s->len;
+		wp += s->cnt;
+	}
+	assert(rp == slen);
+	assert((dest == NULL) || (wp <= dlen));
+	return (ssize_t)wp;
+}
+// What rle8_tbl_next_op() needs from the table, worked out once per buffer.
+struct rle8_enc {
+	const int16_t *cpy_tbl;
+	const int16_t *rep_tbl;
+	const int16_t *lit_tbl;
+	size_t min_rep;
+	size_t max_rep;
+	size_t max_cpy;
+};
+
+static void rle8_enc_init(const struct rle8_tbl *rle, struct rle8_enc *enc) {
+	enc->cpy_tbl = rle->encode_tbl[RLE_OP_CPY];
+	enc->rep_tbl = rle->encode_tbl[RLE_OP_REP];
+	enc->lit_tbl = rle->encode_tbl[RLE_OP_LIT];
+	enc->min_rep = 2;
+	enc->max_rep = 1;
+	enc->max_cpy = 0;
+	if (enc->rep_tbl) {
+		if (rle->minmax_op[RLE_OP_REP][0] > enc->min_rep)
+			enc->min_rep = rle->minmax_op[RLE_OP_REP][0];
+		enc->max_rep = rle->minmax_op[RLE_OP_REP][1] < 255 ? rle->minmax_op[RLE_OP_REP][1] : 255;
+	}
+	if (enc->cpy_tbl)
+		enc->max_cpy = rle->minmax_op[RLE_OP_CPY][1] < 255 ? rle->minmax_op[RLE_OP_CPY][1] : 255;
+}
+
+static inline struct rle8 rle8_enc_next_op(const struct rle8_enc *enc, const uint8_t *src, size_t len) {
+	const int is_lit = enc->lit_tbl && enc->lit_tbl[src[0]] >= 0;
+
+	size_t run = rle_count_rep(src, len, enc->max_rep);
+	if (enc->rep_tbl && (run >= enc->min_rep || (!enc->cpy_tbl && !is_lit))) {
+		while (run > 1 && enc->rep_tbl[run] < 0)
+			--run;
+		if (enc->rep_tbl[run] >= 0)
+			return (struct rle8){ RLE_OP_REP, (uint8_t)run };
+	}
+
+	if (enc->cpy_tbl) {
+		// Step over short runs, which are cheaper to copy, until the start of one worth a REP.
+		const size_t lim = len < enc->max_cpy ? len : enc->max_cpy;
+		size_t cnt = 0;
+		while (cnt < lim) {
+			if (cnt + 1 == len || src[cnt] != src[cnt + 1]) {
+				++cnt;
+				continue;
+			}
+			size_t r = rle_count_rep(src + cnt, len - cnt, enc->min_rep);
+			if (cnt > 0 && r >= enc->min_rep && enc->min_rep <= enc->max_rep)
+				break;
+			cnt += r;
+		}
+		if (cnt > enc->max_cpy)
+			cnt = enc->max_cpy;
+		if (!(cnt == 1 && is_lit) && enc->cpy_tbl[cnt] >= 0)
+			return (struct rle8){ RLE_OP_CPY, (uint8_t)cnt };
+	}
+
+	if (is_lit)
+		return (struct rle8){ RLE_OP_LIT, 1 };
+
+	return (struct rle8){ RLE_OP_INVALID, 0 };
+}
+
+// Returns the op to encode the start of `src` with, and in `cnt` how many input bytes it covers,
+// or RLE_OP_INVALID if the table can't encode the first byte.
+// Runs of at least two bytes, or the shortest REP of the table if longer, are encoded as a REP.
+// Anything else goes into a CPY, which ends where such a run starts, or else into a LIT.
+// This is what the packbits and pcx encoders do, so the output is the same as theirs. The icns encoder
+// instead ends a CPY only once it has taken a run, so a run crossing the largest CPY goes into it there,
+// and the output can differ. The goldbox encoder also differs at the end of the input.
+struct rle8 rle8_tbl_next_op(const struct rle8_tbl *rle, const uint8_t *src, size_t len) {
+	struct rle8_enc enc;
+	rle8_enc_init(rle, &enc);
+	return rle8_enc_next_op(&enc, src, len);
+}
+
+// Compress `src` with any table-described variant, in a single forward pass using rle8_tbl_next_op().
+// Returns the compressed size, or if the input can't be encoded, or doesn't fit in `dest`,
+// -(offset + 1) of the input byte where the op that failed starts.
+ssize_t rle8_tbl_compress(const struct rle8_tbl *rle, const uint8_t *src, size_t slen, uint8_t *dest, size_t dlen) {
+	struct rle8_enc enc;
+	size_t rp = 0;
+	size_t wp = 0;
+
+	rle8_enc_init(rle, &enc);
+	while (rp < slen) {
+		assert((ssize_t)wp >= 0);
+		assert((ssize_t)rp >= 0);
+
+		struct rle8 op = rle8_enc_next_op(&enc, src + rp, slen - rp);
+		if (op.op == RLE_OP_INVALID) {
+			RLE_ZOO_RETURN_ERR;
+		}
+		// Every op is written as its code followed by input bytes; all of them for a CPY,
+		// the first for a REP, and none for a LIT. This avoids branching on the kind of op again.
+		const size_t cnt = op.cnt;
+		const size_t ncopy = (op.op == RLE_OP_CPY) * cnt + (op.op == RLE_OP_REP);
+		if (dest) {
+			if (1 + ncopy > dlen - wp) {
+				RLE_ZOO_RETURN_ERR;
+			}
+			dest[wp] = (uint8_t)rle->encode_tbl[op.op][op.op == RLE_OP_LIT ? src[rp] : cnt];
+			memcpy(dest + wp + 1, src + rp, ncopy);
+		}
+		rp += cnt;
+		wp += 1 + ncopy;
+	}
+	assert(rp == slen);
+	assert((dest == NULL) || (wp <= dlen));
+	return (ssize_t)wp;
+}
+#undef RLE_ZOO_RETURN_ERR
+#undef RLE8_STEP_SLACK
+
 #endif
 
 #ifdef __cplusplus
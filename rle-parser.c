@@ -5,9 +5,6 @@
 	See https://github.com/eloj/rle-zoo
 
 	TODO:
-		The parser is incomplete and not fully functional.
-		'goldbox' encoding is broken -- always uses REP.
-
 		Just give up and use getopt.h
 		Take debug flag to output ops.
 		Log count + ratios of ops, and CPY->REP and REP->CPY transitions.
@@ -25,8 +22,16 @@
 #include <stdint.h>
 #include <assert.h>
 #include <stdbool.h>
+#include <time.h>
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
-#define MAX_BUF_SIZE (8*1024)
+// Output is produced, and written, this many bytes at a time at most, so memory use doesn't grow with the input.
+#define SEGMENT_SIZE (1024*1024)
 
 #include "ops-packbits.h"
 #include "ops-goldbox.h"
@@ -49,6 +54,7 @@ static int debug_hex = 1;
 static int opt_all = 0;
 static int opt_encode = 0;
 static const char *infile;
+static const char *outfile;
 static const char *variant;
 static size_t p_offset;
 static size_t p_len;
@@ -88,6 +94,10 @@ static int parse_args(int argc, char **argv) {
 				case 's':
 					debug_print = 0;
 					break;
+				case 'w':
+					outfile = value;
+					++i;
+					break;
 				case 't':
 					variant = value;
 					++i;
@@ -112,130 +122,250 @@ static int parse_args(int argc, char **argv) {
 	return i;
 }
 
-static int rle_parse_encode(struct rle8_tbl *rle, const uint8_t *src, size_t slen) {
-	printf("WARNING: Encoding is currently broken for some encoding tables, output can be wrong.\n");
-	printf("Encoding %zu byte buffer with '%s'\n", slen, rle->name);
+// Print the ops `src` is encoded with, at their offsets in the input.
+static void rle_parse_encode_trace(struct rle8_tbl *rle, const uint8_t *src, size_t slen) {
 	size_t rp = 0;
-	size_t wp = 0;
-	size_t bailout = 8192;
-
-	struct rle8_params params = {
-		rle->minmax_op[RLE_OP_CPY][0],
-		rle->minmax_op[RLE_OP_CPY][1],
-		rle->minmax_op[RLE_OP_REP][0],
-		rle->minmax_op[RLE_OP_REP][1],
-	};
 
-	printf("Encode params = { cpy:{ %d, %d }, rep:{%d, %d} }\n", params.min_cpy, params.max_cpy, params.min_rep, params.max_rep);
+	while (rp < slen) {
+		struct rle8 op = rle8_tbl_next_op(rle, src + rp, slen - rp);
+		if (op.op == RLE_OP_INVALID)
+			return;
+		if (op.cnt == 0) {
+			printf("%08zx: %s 0 -- stalled\n", rp, rle_op_cstr(op.op));
+			return;
+		}
 
-	if (rle->op_used & (1UL << RLE_OP_LIT)) {
-		printf("Unsupported encode table -- LIT scanning support not yet implemented.\n");
-		return 0;
+		int code = rle->encode_tbl[op.op][op.op == RLE_OP_LIT ? src[rp] : op.cnt];
+		printf("%08zx: <%02x> %s", rp, code, rle_op_cstr(op.op));
+		if (op.op == RLE_OP_REP) {
+			printf(" %d '%02x'", op.cnt, src[rp]);
+		} else if (op.op == RLE_OP_CPY) {
+			printf(" %d", op.cnt);
+			if (debug_hex) {
+				printf(" ; ");
+				fflush(stdout);
+				fprint_hex(stdout, src + rp, op.cnt, 0, NULL, 0);
+			}
+		}
+		printf("\n");
+		rp += op.cnt;
 	}
+}
+
+static double elapsed_ms(const struct timespec *t0, const struct timespec *t1) {
+	return (t1->tv_sec - t0->tv_sec) * 1e3 + (t1->tv_nsec - t0->tv_nsec) / 1e6;
+}
+
+// Open the file given by -w, if any, for writing the output to as it's produced.
+static FILE *open_output(void) {
+	if (!outfile || opt_all)
+		return NULL;
+
+	FILE *f = fopen(outfile, "wb");
+	if (!f)
+		fprintf(stderr, "Error opening output '%s'\n", outfile);
+	return f;
+}
+
+static void close_output(FILE *f, int failed) {
+	if (f && (failed || fclose(f) != 0))
+		fprintf(stderr, "Error writing output '%s'\n", outfile);
+}
+
+// Print the input and output sizes, and the throughput in terms of the uncompressed size `raw`.
+static void print_result(size_t rp, size_t wp, size_t raw, double ms) {
+	printf("Parse: rp=%zu, wp=%zu", rp, wp);
+	if (ms > 0)
+		printf(" (%.1f us, %.1f MiB/s)", ms * 1e3, (raw / (1024.0 * 1024.0)) / (ms / 1e3));
+	printf("\n");
+}
+
+// Find the start of `src`, in whole ops, that the encoder turns into at most `max` bytes, and return its length,
+// with the size of its output in `wlen`. Stops early at an op that can't be encoded, or takes no input, which
+// would stall the encoder.
+static size_t encode_segment(struct rle8_tbl *rle, const uint8_t *src, size_t slen, size_t max, size_t *wlen) {
+	size_t rp = 0;
+	size_t wp = 0;
 
 	while (rp < slen) {
-		struct rle8 res = parse_rle(src + rp, slen - rp, &params);
+		struct rle8 op = rle8_tbl_next_op(rle, src + rp, slen - rp);
+		size_t out = 1 + (op.op == RLE_OP_CPY ? op.cnt : op.op == RLE_OP_REP);
+		if (op.op == RLE_OP_INVALID || op.cnt == 0 || out > max - wp)
+			break;
+		rp += op.cnt;
+		wp += out;
+	}
+	*wlen = wp;
+	return rp;
+}
 
-		if (--bailout == 0) {
-			printf("Encode stalled, bailing.\n");
-			return -3;
-		}
+static int rle_parse_encode(struct rle8_tbl *rle, const uint8_t *src, size_t slen) {
+	printf("Encoding %zu byte buffer with '%s'\n", slen, rle->name);
 
-		if (debug_print)
-			printf("%08zx: ", rp);
+	if (debug_print)
+		rle_parse_encode_trace(rle, src, slen);
 
-		if (res.op == RLE_OP_REP) {
-			int op = rle->encode_tbl[RLE_OP_REP][res.cnt];
-			assert(op > -1);
-			printf("<%02x> REP %d '%02x'\n", op, res.cnt, src[rp]);
-			rp += res.cnt;
-			wp += 2;
-			continue;
-		}
+	uint8_t *out = malloc(SEGMENT_SIZE);
+	if (!out) {
+		fprintf(stderr, "ERROR: Failed to allocate %zu byte output buffer.\n", (size_t)SEGMENT_SIZE);
+		return -4;
+	}
+	FILE *f = open_output();
+	int failed = 0;
+	int res = 0;
+	size_t rp = 0;
+	size_t wp = 0;
+	double ms = 0;
 
-		if (res.op == RLE_OP_CPY) {
-			int op = rle->encode_tbl[RLE_OP_CPY][res.cnt];
-			assert(op > -1);
-			printf("<%02x> CPY %d", op, res.cnt);
-			if (debug_print && debug_hex) {
-				printf(" ; ");
-				fflush(stdout);
-				fprint_hex(stdout, src + rp, res.cnt, 0, NULL, 0);
+	while (rp < slen) {
+		size_t seg_out;
+		size_t seg = encode_segment(rle, src + rp, slen - rp, SEGMENT_SIZE, &seg_out);
+		if (seg == 0) {
+			struct rle8 op = rle8_tbl_next_op(rle, src + rp, slen - rp);
+			if (op.op == RLE_OP_INVALID) {
+				printf("Parse: rp=%zu, byte '%02x' can't be encoded\n", rp, src[rp]);
+			} else {
+				printf("Parse: rp=%zu, encoder stalled on %s 0\n", rp, rle_op_cstr(op.op));
 			}
-			printf("\n");
-			rp += res.cnt;
-			wp += res.cnt + 1;
-			continue;
+			res = -2;
+			break;
 		}
 
-		if (res.op == RLE_OP_LIT) {
-			int op = rle->encode_tbl[RLE_OP_LIT][res.cnt];
-			assert(op > -1);
-			printf("<%02x> LIT %d\n", op, res.cnt);
-			rp += res.cnt;
-			wp += res.cnt;
-			continue;
-		}
-		assert(0 && "Invalid operation returned from parse_rle.");
+		// Encode the rest of the input into exactly the output of the segment, so the ops are the same
+		// as for the whole input, and it stops at the first op that doesn't fit, if there is one.
+		struct timespec t0, t1;
+		timespec_get(&t0, TIME_UTC);
+		ssize_t enc = rle8_tbl_compress(rle, src + rp, slen - rp, out, seg_out);
+		timespec_get(&t1, TIME_UTC);
+		assert(rp + seg == slen ? enc == (ssize_t)seg_out : enc == -(ssize_t)(seg + 1));
+		(void)enc;
+		ms += elapsed_ms(&t0, &t1);
+
+		if (f && fwrite(out, 1, seg_out, f) != seg_out)
+			failed = 1;
+		rp += seg;
+		wp += seg_out;
 	}
 
-	printf("rp=%zu, wp=%zu\n", rp, wp);
+	if (res == 0)
+		print_result(slen, wp, slen, ms);
+	close_output(f, failed);
+	free(out);
 
-	return 0;
+	return res;
 }
 
-static int rle_parse_decode(struct rle8_tbl *rle, const uint8_t *data, size_t len) {
-	printf("Parsing %zu byte buffer with '%s'\n", len, rle->name);
+// Print the ops of `data`, up to the first invalid op.
+static void rle_parse_trace(struct rle8_tbl *rle, const uint8_t *data, size_t len) {
 	size_t rp = 0;
-	size_t wp = 0;
-	size_t bailout = 8192;
 
 	while (rp < len) {
 		uint8_t b = data[rp];
 		struct rle8 op = rle->decode_tbl[b];
 
-		if (op.op != RLE_OP_INVALID) {
-			if (debug_print)
-				printf("%08zx: <%02x> %s", rp, b, rle_op_cstr(op.op));
-			if (op.op == RLE_OP_CPY) {
-				if (debug_print) {
-					printf(" %d", op.cnt);
-					if (debug_hex) {
-						printf(" ; ");
-						fflush(stdout);
-						fprint_hex(stdout, data + rp + 1, op.cnt, 0, NULL, 0);
-					}
-				}
-				rp += 1 + op.cnt;
-				wp += op.cnt;
-			} else if (op.op == RLE_OP_REP) {
-				if (debug_print)
-					printf(" %d '%02x'", op.cnt, data[rp+1]);
-				rp += 2;
-				wp += op.cnt;
-			} else if (op.op == RLE_OP_LIT) {
-				rp += 1;
-				wp += 1;
-			} else if (op.op == RLE_OP_NOP) {
-				rp += 1;
+		printf("%08zx: <%02x> %s", rp, b, rle_op_cstr(op.op));
+		if (op.op == RLE_OP_CPY) {
+			printf(" %d", op.cnt);
+			if (debug_hex) {
+				printf(" ; ");
+				fflush(stdout);
+				fprint_hex(stdout, data + rp + 1, len - rp - 1 < op.cnt ? len - rp - 1 : op.cnt, 0, NULL, 0);
 			}
-			if (debug_print)
-				printf("\n");
+			rp += 1 + op.cnt;
+		} else if (op.op == RLE_OP_REP) {
+			if (rp + 1 < len)
+				printf(" %d '%02x'", op.cnt, data[rp+1]);
+			rp += 2;
+		} else if (op.op == RLE_OP_LIT || op.op == RLE_OP_NOP) {
+			rp += 1;
 		} else {
-			printf("%08zu: <%02x> %s\n", rp, b, rle_op_cstr(op.op));
-			return -2;
+			printf("\n");
+			return;
 		}
+		printf("\n");
+	}
+}
 
-		if (--bailout == 0) {
-			printf("Decode stalled, bailing.\n");
-			return -3;
+// Find the start of `src`, in whole ops, that decodes to at most `max` bytes, and return its length,
+// with the size of its output in `wlen`. The input must already be known to be valid.
+// Every op takes at least one byte of input, so this always makes progress.
+static size_t decode_segment(struct rle8_tbl *rle, const uint8_t *src, size_t slen, size_t max, size_t *wlen) {
+	size_t rp = 0;
+	size_t wp = 0;
+
+	while (rp < slen) {
+		struct rle8 op = rle->decode_tbl[src[rp]];
+		size_t in = 1;
+		size_t out = 0;
+		if (op.op == RLE_OP_CPY) {
+			in += op.cnt;
+			out = op.cnt;
+		} else if (op.op == RLE_OP_REP) {
+			in = 2;
+			out = op.cnt;
+		} else if (op.op == RLE_OP_LIT) {
+			out = 1;
 		}
+		assert(op.op != RLE_OP_INVALID && in <= slen - rp);
+		if (out > max - wp)
+			break;
+		rp += in;
+		wp += out;
 	}
+	*wlen = wp;
+	return rp;
+}
 
-	printf("Parse: rp=%zu, wp=%zu\n", rp, wp);
-	if (rp != len) {
-		return -1;
+static int rle_parse_decode(struct rle8_tbl *rle, const uint8_t *data, size_t len) {
+	printf("Parsing %zu byte buffer with '%s'\n", len, rle->name);
+
+	if (debug_print)
+		rle_parse_trace(rle, data, len);
+
+	// Measure the output first, which also validates the whole input.
+	ssize_t res = rle8_tbl_decompress(rle, data, len, NULL, 0);
+	if (res < 0) {
+		size_t rp = (size_t)(-(res + 1)) - 1;
+		struct rle8 op = rle->decode_tbl[data[rp]];
+		printf("Parse: rp=%zu, error at <%02x> %s\n", rp, data[rp], op.op == RLE_OP_INVALID ? "INVALID" : "truncated");
+		return op.op == RLE_OP_INVALID ? -2 : -1;
+	}
+	const size_t total = (size_t)res;
+
+	uint8_t *out = malloc(SEGMENT_SIZE);
+	if (!out) {
+		fprintf(stderr, "ERROR: Failed to allocate %zu byte output buffer.\n", (size_t)SEGMENT_SIZE);
+		return -4;
+	}
+	FILE *f = open_output();
+	int failed = 0;
+	size_t rp = 0;
+	size_t wp = 0;
+	double ms = 0;
+
+	while (rp < len) {
+		size_t seg_out;
+		size_t seg = decode_segment(rle, data + rp, len - rp, SEGMENT_SIZE, &seg_out);
+
+		struct timespec t0, t1;
+		timespec_get(&t0, TIME_UTC);
+		res = rle8_tbl_decompress(rle, data + rp, seg, out, seg_out);
+		timespec_get(&t1, TIME_UTC);
+		assert((size_t)res == seg_out);
+		ms += elapsed_ms(&t0, &t1);
+
+		if (f && fwrite(out, 1, seg_out, f) != seg_out)
+			failed = 1;
+		rp += seg;
+		wp += seg_out;
 	}
+	assert(wp == total);
+	(void)total;
+
+	print_result(len, wp, wp, ms);
+	close_output(f, failed);
+	free(out);
+
 	// HACKY: Expect at least half the input as output.
 	if (wp < len / 2) {
 		return -2;
@@ -244,6 +374,82 @@ static int rle_parse_decode(struct rle8_tbl *rle, const uint8_t *data, size_t le
 	return 0;
 }
 
+// Read all of `f` into memory, for input that can't be mapped, such as a pipe. Returns NULL on error.
+static uint8_t *read_input(FILE *f, size_t *len) {
+	size_t cap = SEGMENT_SIZE;
+	size_t n = 0;
+	uint8_t *base = malloc(cap);
+	while (base) {
+		if (n == cap) {
+			uint8_t *grown = cap <= SIZE_MAX / 2 ? realloc(base, cap * 2) : NULL;
+			if (!grown)
+				break;
+			base = grown;
+			cap *= 2;
+		}
+		size_t k = fread(base + n, 1, cap - n, f);
+		if (k == 0) {
+			if (ferror(f))
+				break;
+			*len = n;
+			return base;
+		}
+		n += k;
+	}
+	free(base);
+	return NULL;
+}
+
+// Map `filename` into memory, the whole file, with its size in `len`, or read it if it's not a regular file,
+// or empty, in which case `mapped` is cleared. Returns NULL on error.
+static uint8_t *map_input(const char *filename, size_t *len, bool *mapped) {
+	*mapped = false;
+#if !defined(_WIN32)
+	int fd = open(filename, O_RDONLY);
+	if (fd < 0)
+		return NULL;
+	struct stat st;
+	if (fstat(fd, &st) != 0) {
+		close(fd);
+		return NULL;
+	}
+	if (S_ISREG(st.st_mode) && st.st_size > 0) {
+		*len = (size_t)st.st_size;
+		void *base = mmap(NULL, *len, PROT_READ, MAP_PRIVATE, fd, 0);
+		close(fd);
+		if (base == MAP_FAILED)
+			return NULL;
+		*mapped = true;
+		return base;
+	}
+	FILE *f = fdopen(fd, "rb");
+	if (!f) {
+		close(fd);
+		return NULL;
+	}
+#else
+	// No mapping here, so read the whole file instead.
+	FILE *f = fopen(filename, "rb");
+	if (!f)
+		return NULL;
+#endif
+	uint8_t *base = read_input(f, len);
+	fclose(f);
+	return base;
+}
+
+static void unmap_input(uint8_t *base, size_t len, bool mapped) {
+#if !defined(_WIN32)
+	if (mapped) {
+		munmap(base, len);
+		return;
+	}
+#endif
+	(void)len;
+	(void)mapped;
+	free(base);
+}
+
 static struct rle8_tbl* get_rle8_by_name(const char *name) {
 	if (!name)
 		return NULL;
@@ -271,12 +477,13 @@ int main(int argc, char *argv []) {
 	struct rle8_tbl* rle = NULL;
 
 	if (!infile) {
-		printf("Usage: %s [-d|-e] [-s] [-o offset] [-n len] [-t variant|all] <file>\n", argv[0]);
+		printf("Usage: %s [-d|-e] [-s] [-o offset] [-n len] [-w outfile] [-t variant|all] <file>\n", argv[0]);
 		printf("\noptions:\n"
-			"\t-d|-e\tdecode / encode(broken)\n"
+			"\t-d|-e\tdecode / encode\n"
 			"\t-s\t\tsilent -- no debug print\n"
 			"\t-o\t\tfile offset to start at\n"
 			"\t-n\t\tnumber of bytes to process\n"
+			"\t-w\t\twrite output to file\n"
 			"\t-t\t\tcodec name, or 'all'\n"
 		);
 		print_tbl_variants();
@@ -296,26 +503,20 @@ int main(int argc, char *argv []) {
 		return EXIT_FAILURE;
 	}
 
-	if (!p_len)
-		p_len = MAX_BUF_SIZE;
-	if (p_len > MAX_BUF_SIZE) {
-		fprintf(stderr, "ERROR: len > %zu; reduce len, or increase MAX_BUF_SIZE.\n", (size_t)MAX_BUF_SIZE);
-		exit(1);
-	}
-
-	FILE *f = fopen(infile, "rb");
-	if (!f) {
+	size_t map_len;
+	bool mapped;
+	uint8_t *map = map_input(infile, &map_len, &mapped);
+	if (!map) {
 		fprintf(stderr, "Error opening input '%s'\n", infile);
 		return EXIT_FAILURE;
 	}
-	printf("Reading input from '%s' (offset=0x%zx, max len=0x%zx)\n", infile, p_offset, p_len);
+	if (p_offset > map_len)
+		p_offset = map_len;
+	if (!p_len || p_len > map_len - p_offset)
+		p_len = map_len - p_offset;
+	printf("Reading input from '%s' (offset=0x%zx, len=0x%zx)\n", infile, p_offset, p_len);
 
-	uint8_t *buf = malloc(p_len);
-	if (p_offset) {
-		fseek(f, p_offset, SEEK_SET);
-	}
-	p_len = fread(buf, 1, p_len, f);
-	fclose(f);
+	const uint8_t *buf = map + p_offset;
 
 	if (opt_all) {
 		int res;
@@ -341,7 +542,7 @@ int main(int argc, char *argv []) {
 		}
 	}
 
-	free(buf);
+	unmap_input(map, map_len, mapped);
 
 	return EXIT_SUCCESS;
 }
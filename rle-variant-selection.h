@@ -33,6 +33,56 @@ struct rle_t {
 		.compress = icns_compress,
 		.decompress = icns_decompress
 	},
+	{
+		.name = "tga8",
+		.compress = tga8_compress,
+		.decompress = tga8_decompress
+	},
+	{
+		.name = "tga16",
+		.compress = tga16_compress,
+		.decompress = tga16_decompress
+	},
+	{
+		.name = "tga24",
+		.compress = tga24_compress,
+		.decompress = tga24_decompress
+	},
+	{
+		.name = "tga32",
+		.compress = tga32_compress,
+		.decompress = tga32_decompress
+	},
+	{
+		.name = "bmp8",
+		.compress = bmp_rle8_compress,
+		.decompress = bmp_rle8_decompress
+	},
+	{
+		.name = "bitrun",
+		.compress = bitrun_compress,
+		.decompress = bitrun_decompress
+	},
+	{
+		.name = "packbits4",
+		.compress = nibble_packbits_compress,
+		.decompress = nibble_packbits_decompress
+	},
+	{
+		.name = "bmp4",
+		.compress = nibble_bmp_rle4_compress,
+		.decompress = nibble_bmp_rle4_decompress
+	},
+	{
+		.name = "pict16",
+		.compress = pict16_compress,
+		.decompress = pict16_decompress
+	},
+	{
+		.name = "exepack",
+		.compress = exepack_compress,
+		.decompress = exepack_decompress
+	},
 };
 
 static const size_t RLE_ZOO_NUM_VARIANTS = sizeof(rle_variants)/sizeof(rle_variants[0]);
@@ -17,6 +17,12 @@
 #include "rle_packbits.h"
 #include "rle_pcx.h"
 #include "rle_icns.h"
+#include "rle_tga.h"
+#include "rle_bmp.h"
+#include "rle_bitrun.h"
+#include "rle_nibble.h"
+#include "rle_pict.h"
+#include "rle_exepack.h"
 
 #include "rle-variant-selection.h"
 
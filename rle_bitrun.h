@@ -0,0 +1,226 @@
+/*
+	Run-Length Encoder/Decoder (RLE), Bit-Run Variant for 1-bpp Bitmaps
+	Copyright (c) 2022, Eddy L O Jansson. Licensed under The MIT License.
+
+	The input is treated as a string of bits, most significant bit first,
+	and encoded as the lengths of alternating runs of zeros and ones. The
+	first run is of zeros, and may be empty.
+
+	Each run length is stored as a little-endian base-128 varint (LEB128),
+	i.e seven bits per byte, with the high bit set on all but the last byte.
+
+	See https://github.com/eloj/rle-zoo
+*/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stddef.h>
+#if defined(_MSC_VER)
+#include <BaseTsd.h>
+typedef SSIZE_T ssize_t;
+#else
+#include <sys/types.h> // ssize_t
+#endif
+
+ssize_t bitrun_compress(const uint8_t *src, size_t slen, uint8_t *dest, size_t dlen);
+ssize_t bitrun_decompress(const uint8_t *src, size_t slen, uint8_t *dest, size_t dlen);
+
+#if defined(RLE_ZOO_BITRUN_IMPLEMENTATION) || defined(RLE_ZOO_IMPLEMENTATION)
+#include <assert.h>
+#include <string.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+static_assert(sizeof(size_t) == sizeof(ssize_t), "");
+
+// return -(rp + 1) ... mask so it can't flip positive. Give up and just always return -1?
+#define RLE_ZOO_RETURN_ERR return ~(rp & ((size_t)~0 >> 1UL))
+
+// Longest accepted varint; 63 bits of run length.
+#define BITRUN_MAX_VARINT 9
+
+// Count leading zeros; `x` must be non-zero.
+static inline unsigned int bitrun_clz64(uint64_t x) {
+#if defined(_MSC_VER)
+	unsigned long idx;
+	_BitScanReverse64(&idx, x);
+	return 63 - (unsigned int)idx;
+#else
+	return (unsigned int)__builtin_clzll(x);
+#endif
+}
+
+// Load up to eight bytes as a big-endian word, zero-padded at the end.
+static inline uint64_t bitrun_load_be64(const uint8_t *p, size_t avail) {
+	uint64_t res = 0;
+	if (avail >= 8) {
+		for (int i = 0 ; i < 8 ; ++i)
+			res = (res << 8) | p[i];
+	} else {
+		for (size_t i = 0 ; i < 8 ; ++i)
+			res = (res << 8) | (i < avail ? p[i] : 0);
+	}
+	return res;
+}
+
+static inline void bitrun_store_be64(uint8_t *p, uint64_t v, size_t len) {
+	for (size_t i = 0 ; i < len ; ++i)
+		p[i] = (uint8_t)(v >> (56 - 8 * i));
+}
+
+// Count the bits equal to `bit` starting at bit position `pos`, a 64-bit word at a time.
+static size_t bitrun_count(const uint8_t *src, size_t slen, size_t pos, int bit) {
+	const size_t nbits = slen * 8;
+	size_t run = 0;
+	while (pos < nbits) {
+		size_t k = pos / 8;
+		unsigned int sh = pos % 8;
+		uint64_t w = bitrun_load_be64(src + k, slen - k) << sh;
+		size_t valid = ((slen - k) >= 8 ? 64 : (slen - k) * 8) - sh;
+		if (bit)
+			w = ~w;
+		size_t n = w ? bitrun_clz64(w) : 64;
+		if (n < valid) {
+			return run + n;
+		}
+		run += valid;
+		pos += valid;
+	}
+	return run;
+}
+
+ssize_t bitrun_compress(const uint8_t *src, size_t slen, uint8_t *dest, size_t dlen) {
+	const size_t nbits = slen * 8;
+	size_t rp = 0; // in bits
+	size_t wp = 0;
+	int bit = 0;
+
+	while (rp < nbits) {
+		assert((ssize_t)wp >= 0);
+
+		size_t run = bitrun_count(src, slen, rp, bit);
+
+		// Output varint
+		size_t v = run;
+		do {
+			uint8_t b = (uint8_t)(v & 0x7F);
+			v >>= 7;
+			if (v)
+				b |= 0x80;
+			if (dest) {
+				if (wp < dlen) {
+					dest[wp] = b;
+				} else {
+					rp /= 8;
+					RLE_ZOO_RETURN_ERR;
+				}
+			}
+			++wp;
+		} while (v);
+
+		rp += run;
+		bit ^= 1;
+	}
+	assert(rp == nbits);
+	assert((dest == NULL) || (wp <= dlen));
+	return (ssize_t)wp;
+}
+
+ssize_t bitrun_decompress(const uint8_t *src, size_t slen, uint8_t *dest, size_t dlen) {
+	size_t wp = 0;
+	size_t rp = 0;
+	uint64_t acc = 0; // pending output bits, msb first
+	unsigned int nacc = 0;
+	int bit = 0;
+
+	while (rp < slen) {
+		assert((ssize_t)wp >= 0);
+		assert((ssize_t)rp >= 0);
+
+		// Read varint
+		uint64_t run = 0;
+		unsigned int shift = 0;
+		uint8_t b;
+		do {
+			if (!(rp < slen) || shift >= 7 * BITRUN_MAX_VARINT) {
+				RLE_ZOO_RETURN_ERR;
+			}
+			b = src[rp++];
+			run |= (uint64_t)(b & 0x7F) << shift;
+			shift += 7;
+		} while (b & 0x80);
+
+		// Refuse output sizes that can't be represented in the return value.
+		if (run / 8 > ((size_t)~0 >> 2) - wp) {
+			RLE_ZOO_RETURN_ERR;
+		}
+
+		const uint64_t fill = bit ? ~(uint64_t)0 : 0;
+		while (run > 0) {
+			if (nacc == 0 && run >= 64) {
+				// Whole words of the run, straight to the output.
+				size_t len = (size_t)(run / 64) * 8;
+				if (dest) {
+					if (wp + len <= dlen) {
+						memset(dest + wp, (int)(fill & 0xFF), len);
+					} else {
+						RLE_ZOO_RETURN_ERR;
+					}
+				}
+				wp += len;
+				run -= (uint64_t)len * 8;
+				continue;
+			}
+			// Merge the head or tail of the run into the pending word.
+			unsigned int take = 64 - nacc;
+			if (run < take)
+				take = (unsigned int)run;
+			uint64_t mask = ~(uint64_t)0 >> nacc;
+			if (nacc + take < 64)
+				mask &= ~(~(uint64_t)0 >> (nacc + take));
+			acc |= fill & mask;
+			nacc += take;
+			run -= take;
+			if (nacc == 64) {
+				if (dest) {
+					if (wp + 8 <= dlen) {
+						bitrun_store_be64(dest + wp, acc, 8);
+					} else {
+						RLE_ZOO_RETURN_ERR;
+					}
+				}
+				wp += 8;
+				acc = 0;
+				nacc = 0;
+			}
+		}
+		bit ^= 1;
+	}
+
+	// The runs must add up to whole bytes.
+	if (nacc % 8 != 0) {
+		RLE_ZOO_RETURN_ERR;
+	}
+	if (dest && nacc) {
+		if (wp + nacc / 8 <= dlen) {
+			bitrun_store_be64(dest + wp, acc, nacc / 8);
+		} else {
+			RLE_ZOO_RETURN_ERR;
+		}
+	}
+	wp += nacc / 8;
+
+	assert(rp == slen);
+	assert((dest == NULL) || (wp <= dlen));
+	return (ssize_t)wp;
+}
+#undef BITRUN_MAX_VARINT
+#undef RLE_ZOO_RETURN_ERR
+#endif
+
+#ifdef __cplusplus
+}
+#endif
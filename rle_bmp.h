@@ -0,0 +1,293 @@
+/*
+	Run-Length Encoder/Decoder (RLE), Windows BMP RLE8/RLE4 Variant
+	Copyright (c) 2022, Eddy L O Jansson. Licensed under The MIT License.
+
+	The BMP escapes for end-of-line, end-of-bitmap and delta move the output
+	cursor around a two-dimensional bitmap, so the real decoders are the
+	`_image` functions, which take the bitmap width, height and pitch.
+
+	The plain bmp_rle8_compress/decompress functions treat the input as one
+	long scanline, which is what the rest of the zoo expects.
+
+	See https://github.com/eloj/rle-zoo
+*/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stddef.h>
+#if defined(_MSC_VER)
+#include <BaseTsd.h>
+typedef SSIZE_T ssize_t;
+#else
+#include <sys/types.h> // ssize_t
+#endif
+
+ssize_t bmp_rle8_compress(const uint8_t *src, size_t slen, uint8_t *dest, size_t dlen);
+ssize_t bmp_rle8_decompress(const uint8_t *src, size_t slen, uint8_t *dest, size_t dlen);
+
+ssize_t bmp_rle8_compress_image(const uint8_t *src, ptrdiff_t pitch, size_t width, size_t height, uint8_t *dest, size_t dlen);
+ssize_t bmp_rle8_decompress_image(const uint8_t *src, size_t slen, uint8_t *dest, ptrdiff_t pitch, size_t width, size_t height);
+ssize_t bmp_rle4_decompress_image(const uint8_t *src, size_t slen, uint8_t *dest, ptrdiff_t pitch, size_t width, size_t height);
+
+#if defined(RLE_ZOO_BMP_IMPLEMENTATION) || defined(RLE_ZOO_IMPLEMENTATION)
+#include <assert.h>
+#include <string.h>
+
+static_assert(sizeof(size_t) == sizeof(ssize_t), "");
+
+// return -(rp + 1) ... mask so it can't flip positive. Give up and just always return -1?
+#define RLE_ZOO_RETURN_ERR return ~(rp & ((size_t)~0 >> 1UL))
+
+enum {
+	BMP_ESC_EOL = 0,
+	BMP_ESC_EOB = 1,
+	BMP_ESC_DELTA = 2,
+};
+
+// Encode one run of `slen` bytes, without any terminating escape.
+// RLE PARAMS: min REP=1, max REP=255, min ABS=3, max ABS=255
+static ssize_t bmp_rle8_encode_line(const uint8_t *src, size_t slen, uint8_t *dest, size_t dlen, size_t wp) {
+	size_t rp = 0;
+
+	while (rp < slen) {
+		assert((ssize_t)wp >= 0);
+		assert((ssize_t)rp >= 0);
+
+		size_t cnt = 0;
+		do { ++cnt; } while ((rp + cnt < slen) && (cnt < 255) && (src[rp + cnt - 1] == src[rp + cnt]));
+
+		if (cnt == 1) {
+			// Count number of literal bytes, up to 255, stopping short of any pair.
+			while ((rp + cnt < slen) && (cnt < 255) && ((rp + cnt + 1 == slen) || (src[rp + cnt] != src[rp + cnt + 1]))) {
+				++cnt;
+			}
+			// Output CPY (absolute mode), which can't encode fewer than three bytes.
+			if (cnt >= 3) {
+				size_t len = 2 + cnt + (cnt & 1);
+				if (dest) {
+					if (wp + len <= dlen) {
+						dest[wp + 0] = 0;
+						dest[wp + 1] = (uint8_t)cnt;
+						memcpy(dest + wp + 2, src + rp, cnt);
+						if (cnt & 1)
+							dest[wp + 2 + cnt] = 0;
+					} else {
+						RLE_ZOO_RETURN_ERR;
+					}
+				}
+				rp += cnt;
+				wp += len;
+				continue;
+			}
+			cnt = 1;
+		}
+
+		// Output REP, also used for literals too short for absolute mode.
+		if (dest) {
+			if (wp + 2 <= dlen) {
+				dest[wp + 0] = (uint8_t)cnt;
+				dest[wp + 1] = src[rp];
+			} else {
+				RLE_ZOO_RETURN_ERR;
+			}
+		}
+		rp += cnt;
+		wp += 2;
+	}
+	return (ssize_t)wp;
+}
+
+static ssize_t bmp_rle8_encode_escape(uint8_t esc, uint8_t *dest, size_t dlen, size_t wp) {
+	if (dest) {
+		if (wp + 2 <= dlen) {
+			dest[wp + 0] = 0;
+			dest[wp + 1] = esc;
+		} else {
+			return -1;
+		}
+	}
+	return (ssize_t)(wp + 2);
+}
+
+ssize_t bmp_rle8_compress(const uint8_t *src, size_t slen, uint8_t *dest, size_t dlen) {
+	ssize_t res = bmp_rle8_encode_line(src, slen, dest, dlen, 0);
+	if (res < 0)
+		return res;
+	return bmp_rle8_encode_escape(BMP_ESC_EOB, dest, dlen, (size_t)res);
+}
+
+// The output has an end-of-line after each row, followed by an end-of-bitmap.
+// For bottom-up bitmaps, point `src` at the last row in memory and pass a negative pitch.
+ssize_t bmp_rle8_compress_image(const uint8_t *src, ptrdiff_t pitch, size_t width, size_t height, uint8_t *dest, size_t dlen) {
+	size_t wp = 0;
+	for (size_t y = 0 ; y < height ; ++y) {
+		ssize_t res = bmp_rle8_encode_line(src + (ptrdiff_t)y * pitch, width, dest, dlen, wp);
+		if (res >= 0)
+			res = bmp_rle8_encode_escape(BMP_ESC_EOL, dest, dlen, (size_t)res);
+		if (res < 0)
+			return -1;
+		wp = (size_t)res;
+	}
+	return bmp_rle8_encode_escape(BMP_ESC_EOB, dest, dlen, wp);
+}
+
+// Decodes until end-of-bitmap or end of input, whichever comes first. End-of-line is a no-op,
+// and a delta is an error, since there are no lines.
+ssize_t bmp_rle8_decompress(const uint8_t *src, size_t slen, uint8_t *dest, size_t dlen) {
+	size_t wp = 0;
+	size_t rp = 0;
+	while (rp < slen) {
+		assert((ssize_t)wp >= 0);
+		assert((ssize_t)rp >= 0);
+
+		size_t cnt = src[rp++];
+		if (!(rp < slen)) {
+			RLE_ZOO_RETURN_ERR;
+		}
+		uint8_t b = src[rp++];
+		if (cnt > 0) {
+			// REP
+			if (dest) {
+				if (wp + cnt <= dlen) {
+					memset(dest + wp, b, cnt);
+				} else {
+					RLE_ZOO_RETURN_ERR;
+				}
+			}
+		} else if (b == BMP_ESC_EOL) {
+			continue;
+		} else if (b == BMP_ESC_EOB) {
+			break;
+		} else if (b == BMP_ESC_DELTA) {
+			RLE_ZOO_RETURN_ERR;
+		} else {
+			// CPY, padded to an even number of bytes.
+			cnt = b;
+			if (!(rp + cnt <= slen)) {
+				RLE_ZOO_RETURN_ERR;
+			}
+			if (dest) {
+				if (wp + cnt <= dlen) {
+					memcpy(dest + wp, src + rp, cnt);
+				} else {
+					RLE_ZOO_RETURN_ERR;
+				}
+			}
+			rp += cnt + (cnt & 1);
+			if (rp > slen)
+				rp = slen;
+		}
+		wp += cnt;
+	}
+	assert((dest == NULL) || (wp <= dlen));
+	return (ssize_t)wp;
+}
+
+// Shared decoder for RLE8 and RLE4. Pixels skipped by end-of-line or delta are never touched.
+// For bottom-up bitmaps, point `dest` at the last row in memory and pass a negative pitch.
+// Returns the number of input bytes consumed, up to and including the end-of-bitmap.
+static ssize_t bmp_decompress_image(const uint8_t *src, size_t slen, uint8_t *dest, ptrdiff_t pitch, size_t width, size_t height, int bpp) {
+	size_t rp = 0;
+	size_t x = 0;
+	size_t y = 0;
+
+	while (rp < slen) {
+		size_t cnt = src[rp++];
+		if (!(rp < slen)) {
+			RLE_ZOO_RETURN_ERR;
+		}
+		uint8_t b = src[rp++];
+
+		if (cnt == 0 && b == BMP_ESC_EOL) {
+			x = 0;
+			++y;
+			continue;
+		} else if (cnt == 0 && b == BMP_ESC_EOB) {
+			break;
+		} else if (cnt == 0 && b == BMP_ESC_DELTA) {
+			if (!(rp + 2 <= slen)) {
+				RLE_ZOO_RETURN_ERR;
+			}
+			x += src[rp++];
+			y += src[rp++];
+			if (x > width || y > height) {
+				RLE_ZOO_RETURN_ERR;
+			}
+			continue;
+		}
+
+		const uint8_t *payload = NULL;
+		if (cnt == 0) {
+			// Absolute mode; `b` pixels follow, padded to an even number of bytes.
+			cnt = b;
+			size_t plen = (bpp == 8) ? cnt : (cnt + 1) / 2;
+			if (!(rp + plen <= slen)) {
+				RLE_ZOO_RETURN_ERR;
+			}
+			payload = src + rp;
+			rp += plen + (plen & 1);
+			if (rp > slen)
+				rp = slen;
+		}
+
+		if (y >= height || x + cnt > width) {
+			RLE_ZOO_RETURN_ERR;
+		}
+
+		uint8_t *row = dest + (ptrdiff_t)y * pitch;
+		if (bpp == 8) {
+			if (payload)
+				memcpy(row + x, payload, cnt);
+			else
+				memset(row + x, b, cnt);
+		} else {
+			// Pixels are packed high nibble first. Fill or copy whole bytes when the
+			// destination is byte-aligned, and a nibble at a time only at the edges.
+			size_t i = 0;
+			if (payload) {
+				if ((x & 1) == 0) {
+					memcpy(row + x / 2, payload, cnt / 2);
+					i = cnt & ~(size_t)1;
+				}
+				for ( ; i < cnt ; ++i) {
+					uint8_t v = (i & 1) ? (payload[i / 2] & 0x0F) : (uint8_t)(payload[i / 2] >> 4);
+					uint8_t *p = row + (x + i) / 2;
+					*p = ((x + i) & 1) ? (uint8_t)((*p & 0xF0) | v) : (uint8_t)((*p & 0x0F) | (v << 4));
+				}
+			} else {
+				if (x & 1) {
+					// Odd start, first pixel goes into a low nibble, then the pair pattern is swapped.
+					uint8_t *p = row + x / 2;
+					*p = (uint8_t)((*p & 0xF0) | (b >> 4));
+					b = (uint8_t)((b << 4) | (b >> 4));
+					i = 1;
+				}
+				size_t pairs = (cnt - i) / 2;
+				memset(row + (x + i) / 2, b, pairs);
+				i += pairs * 2;
+				if (i < cnt) {
+					uint8_t *p = row + (x + i) / 2;
+					*p = (uint8_t)((*p & 0x0F) | (b & 0xF0));
+				}
+			}
+		}
+		x += cnt;
+	}
+	return (ssize_t)rp;
+}
+
+ssize_t bmp_rle8_decompress_image(const uint8_t *src, size_t slen, uint8_t *dest, ptrdiff_t pitch, size_t width, size_t height) {
+	return bmp_decompress_image(src, slen, dest, pitch, width, height, 8);
+}
+
+ssize_t bmp_rle4_decompress_image(const uint8_t *src, size_t slen, uint8_t *dest, ptrdiff_t pitch, size_t width, size_t height) {
+	return bmp_decompress_image(src, slen, dest, pitch, width, height, 4);
+}
+#undef RLE_ZOO_RETURN_ERR
+#endif
+
+#ifdef __cplusplus
+}
+#endif
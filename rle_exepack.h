@@ -0,0 +1,310 @@
+/*
+	Run-Length Encoder/Decoder (RLE), Microsoft EXEPACK Variant
+	Copyright (c) 2022, Eddy L O Jansson. Licensed under The MIT License.
+
+	EXEPACK compresses DOS executables, and its stub decompresses them in
+	place, working backwards from the end of the data towards the start.
+	The output is written downwards from the end of the uncompressed size,
+	so as long as the data expands as it's decoded, the writes never catch
+	up with the data still to be read.
+
+	The data is an uncompressed prefix followed by commands, each stored
+	back to front; the command byte comes last, preceded by a little-endian
+	16-bit length, and for a fill, the fill byte before that.
+
+	See https://github.com/eloj/rle-zoo
+*/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stddef.h>
+#if defined(_MSC_VER)
+#include <BaseTsd.h>
+typedef SSIZE_T ssize_t;
+#else
+#include <sys/types.h> // ssize_t
+#endif
+
+ssize_t exepack_compress(const uint8_t *src, size_t slen, uint8_t *dest, size_t dlen);
+ssize_t exepack_decompress(const uint8_t *src, size_t slen, uint8_t *dest, size_t dlen);
+ssize_t exepack_decompress_inplace(uint8_t *buf, size_t slen, size_t blen);
+
+#if defined(RLE_ZOO_EXEPACK_IMPLEMENTATION) || defined(RLE_ZOO_IMPLEMENTATION)
+#include <assert.h>
+#include <string.h>
+
+static_assert(sizeof(size_t) == sizeof(ssize_t), "");
+
+// return -(rp + 1) ... mask so it can't flip positive. Give up and just always return -1?
+#define RLE_ZOO_RETURN_ERR return ~(rp & ((size_t)~0 >> 1UL))
+
+enum {
+	EXEPACK_FILL = 0xB0,
+	EXEPACK_COPY = 0xB2,
+	EXEPACK_FINAL = 0x01,
+};
+
+#define EXEPACK_MAX_LEN 0xFFFF
+// The stub skips up to this many bytes of 0xFF padding at the end of the data.
+#define EXEPACK_MAX_PADDING 15
+// Runs at least this long are worth a fill, even in the middle of a copy.
+#define EXEPACK_MIN_FILL 8
+
+// Find the next command for the input at `rp`. Returns the command, and its length in `len`.
+static inline uint8_t exepack_next_cmd(const uint8_t *src, size_t slen, size_t rp, size_t *len) {
+	size_t max = slen - rp < EXEPACK_MAX_LEN ? slen - rp : EXEPACK_MAX_LEN;
+	size_t run = 1;
+	while (run < max && src[rp + run] == src[rp]) {
+		++run;
+	}
+	if (run >= EXEPACK_MIN_FILL) {
+		*len = run;
+		return EXEPACK_FILL;
+	}
+	// Copy up to the start of the next run worth a fill.
+	size_t cnt = run;
+	while (cnt < max) {
+		run = 1;
+		while (cnt + run < max && run < EXEPACK_MIN_FILL && src[rp + cnt + run] == src[rp + cnt]) {
+			++run;
+		}
+		if (run >= EXEPACK_MIN_FILL)
+			break;
+		cnt += run;
+	}
+	*len = cnt;
+	return EXEPACK_COPY;
+}
+
+static inline size_t exepack_cmd_size(uint8_t cmd, size_t len) {
+	return cmd == EXEPACK_FILL ? 4 : 3 + len;
+}
+
+// RLE PARAMS: min CPY=0, max CPY=65535, min REP=8, max REP=65535
+ssize_t exepack_compress(const uint8_t *src, size_t slen, uint8_t *dest, size_t dlen) {
+	size_t rp = 0;
+	size_t wp = 0;
+
+	if (slen == 0)
+		return 0;
+
+	// The decoder processes the commands last to first, so for it to work in place, every run of
+	// commands from the start must expand the data. Any leading commands that don't, can just as
+	// well be stored as an uncompressed prefix, so find the lowest point of the running gain.
+	size_t prefix = 0;
+	ssize_t gain = 0;
+	ssize_t min_gain = 0;
+	while (rp < slen) {
+		size_t len;
+		uint8_t cmd = exepack_next_cmd(src, slen, rp, &len);
+		rp += len;
+		gain += (ssize_t)len - (ssize_t)exepack_cmd_size(cmd, len);
+		if (gain <= min_gain) {
+			min_gain = gain;
+			prefix = rp;
+		}
+	}
+
+	if (dest) {
+		if (prefix > dlen) {
+			rp = 0;
+			RLE_ZOO_RETURN_ERR;
+		}
+		memcpy(dest, src, prefix);
+	}
+	wp = prefix;
+	rp = prefix;
+
+	// If everything went into the prefix, the data still needs a final command, so use an empty copy.
+	if (rp == slen) {
+		if (dest) {
+			if (wp + 3 <= dlen) {
+				dest[wp + 0] = 0;
+				dest[wp + 1] = 0;
+				dest[wp + 2] = EXEPACK_COPY | EXEPACK_FINAL;
+			} else {
+				RLE_ZOO_RETURN_ERR;
+			}
+		}
+		return (ssize_t)(wp + 3);
+	}
+
+	uint8_t final = EXEPACK_FINAL;
+	while (rp < slen) {
+		assert((ssize_t)wp >= 0);
+		assert((ssize_t)rp >= 0);
+
+		size_t len;
+		uint8_t cmd = exepack_next_cmd(src, slen, rp, &len);
+		size_t size = exepack_cmd_size(cmd, len);
+		assert(len > 0 && len <= EXEPACK_MAX_LEN);
+
+		if (dest) {
+			if (wp + size <= dlen) {
+				uint8_t *p = dest + wp;
+				if (cmd == EXEPACK_FILL) {
+					*p++ = src[rp];
+				} else {
+					memcpy(p, src + rp, len);
+					p += len;
+				}
+				p[0] = (uint8_t)len;
+				p[1] = (uint8_t)(len >> 8);
+				p[2] = cmd | final;
+			} else {
+				RLE_ZOO_RETURN_ERR;
+			}
+		}
+		final = 0;
+		rp += len;
+		wp += size;
+	}
+	assert(rp == slen);
+	assert((dest == NULL) || (wp <= dlen));
+	return (ssize_t)wp;
+}
+
+// Scan the commands from the end, without producing any output. Returns the uncompressed size,
+// and where the commands end, after any padding, in `end`, or an error.
+static ssize_t exepack_scan(const uint8_t *src, size_t slen, size_t *end) {
+	size_t rp = slen;
+	size_t wp = 0;
+
+	while (rp > 0 && slen - rp < EXEPACK_MAX_PADDING && src[rp - 1] == 0xFF) {
+		--rp;
+	}
+	*end = rp;
+
+	for (;;) {
+		assert((ssize_t)wp >= 0);
+		assert((ssize_t)rp >= 0);
+
+		if (rp < 3) {
+			rp = 0;
+			RLE_ZOO_RETURN_ERR;
+		}
+		uint8_t cmd = src[rp - 1];
+		size_t len = (size_t)src[rp - 3] | (size_t)src[rp - 2] << 8;
+		size_t op = rp - 1;
+		rp -= 3;
+		if ((cmd & 0xFE) == EXEPACK_FILL) {
+			if (rp < 1) {
+				rp = op;
+				RLE_ZOO_RETURN_ERR;
+			}
+			rp -= 1;
+		} else if ((cmd & 0xFE) == EXEPACK_COPY) {
+			if (rp < len) {
+				rp = op;
+				RLE_ZOO_RETURN_ERR;
+			}
+			rp -= len;
+		} else {
+			rp = op;
+			RLE_ZOO_RETURN_ERR;
+		}
+		wp += len;
+		if (cmd & EXEPACK_FINAL)
+			break;
+	}
+	// What's left is the uncompressed prefix.
+	return (ssize_t)(wp + rp);
+}
+
+// Decode the commands of `src`, ending at `rp`, backwards into `dest` from `wp` down, where `src` and `dest`
+// may be the same buffer. Unless `inplace` is set, `src` and `dest` must not overlap at all.
+// The scan has already checked that the commands are valid. Returns the length of the prefix.
+static ssize_t exepack_unpack(const uint8_t *src, size_t rp, uint8_t *dest, size_t wp, int inplace) {
+	for (;;) {
+		uint8_t cmd = src[rp - 1];
+		size_t len = (size_t)src[rp - 3] | (size_t)src[rp - 2] << 8;
+		size_t op = rp - 1;
+		rp -= 3;
+		assert(wp >= len);
+		if ((cmd & 0xFE) == EXEPACK_FILL) {
+			uint8_t v = src[--rp];
+			// Writes must stay clear of what's left to read.
+			if (inplace && wp - len < rp) {
+				rp = op;
+				RLE_ZOO_RETURN_ERR;
+			}
+			memset(dest + wp - len, v, len);
+		} else {
+			rp -= len;
+			if (inplace) {
+				if (wp < rp + len) {
+					rp = op;
+					RLE_ZOO_RETURN_ERR;
+				}
+				memmove(dest + wp - len, src + rp, len);
+			} else {
+				memcpy(dest + wp - len, src + rp, len);
+			}
+		}
+		wp -= len;
+		if (cmd & EXEPACK_FINAL)
+			break;
+	}
+	assert(wp == rp);
+	return (ssize_t)rp;
+}
+
+ssize_t exepack_decompress(const uint8_t *src, size_t slen, uint8_t *dest, size_t dlen) {
+	size_t rp = 0;
+	size_t end;
+
+	if (slen == 0)
+		return 0;
+
+	ssize_t res = exepack_scan(src, slen, &end);
+	if (res < 0 || dest == NULL)
+		return res;
+	size_t wp = (size_t)res;
+	if (wp > dlen) {
+		// Report the end of the commands, since nothing is written out of order.
+		rp = end;
+		RLE_ZOO_RETURN_ERR;
+	}
+
+	// The prefix is the same in the output.
+	size_t prefix = (size_t)exepack_unpack(src, end, dest, wp, 0);
+	memcpy(dest, src, prefix);
+	return (ssize_t)wp;
+}
+
+// Decompress the `slen` bytes at the start of `buf` in place, into at most `blen` bytes.
+// Returns the uncompressed size, or an error, also if the data doesn't expand enough to
+// be decoded in place; in which case `buf` is left partly decoded.
+ssize_t exepack_decompress_inplace(uint8_t *buf, size_t slen, size_t blen) {
+	size_t rp = 0;
+	size_t end;
+
+	if (slen == 0)
+		return 0;
+	assert(slen <= blen);
+
+	ssize_t res = exepack_scan(buf, slen, &end);
+	if (res < 0)
+		return res;
+	size_t wp = (size_t)res;
+	if (wp > blen || wp < end) {
+		rp = end;
+		RLE_ZOO_RETURN_ERR;
+	}
+
+	res = exepack_unpack(buf, end, buf, wp, 1);
+	if (res < 0)
+		return res;
+	return (ssize_t)wp;
+}
+#undef EXEPACK_MAX_LEN
+#undef EXEPACK_MAX_PADDING
+#undef EXEPACK_MIN_FILL
+#undef RLE_ZOO_RETURN_ERR
+#endif
+
+#ifdef __cplusplus
+}
+#endif
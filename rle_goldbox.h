@@ -19,10 +19,15 @@ typedef SSIZE_T ssize_t;
 #include <sys/types.h> // ssize_t
 #endif
 
+// Guarded, since the DAX archive reader includes this header too.
+#ifndef RLE_ZOO_GOLDBOX_H
+#define RLE_ZOO_GOLDBOX_H
 ssize_t goldbox_compress(const uint8_t *src, size_t slen, uint8_t *dest, size_t dlen);
 ssize_t goldbox_decompress(const uint8_t *src, size_t slen, uint8_t *dest, size_t dlen);
+#endif
 
-#if defined(RLE_ZOO_GOLDBOX_IMPLEMENTATION) || defined(RLE_ZOO_IMPLEMENTATION)
+#if (defined(RLE_ZOO_GOLDBOX_IMPLEMENTATION) || defined(RLE_ZOO_IMPLEMENTATION)) && !defined(RLE_ZOO_GOLDBOX_IMPLEMENTED)
+#define RLE_ZOO_GOLDBOX_IMPLEMENTED
 #include <assert.h>
 
 static_assert(sizeof(size_t) == sizeof(ssize_t), "");
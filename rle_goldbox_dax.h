@@ -0,0 +1,301 @@
+/*
+	SSI Goldbox DAX Resource Archive Reader/Writer
+	Copyright (c) 2022, Eddy L O Jansson. Licensed under The MIT License.
+
+	The Goldbox games store their resources in DAX archives. A DAX file
+	starts with a little-endian 16-bit index size, followed by the index,
+	with nine bytes per record:
+
+		uint8_t id
+		uint32_t offset		// From the end of the index.
+		uint16_t raw_size	// Decompressed size.
+		uint16_t comp_size
+
+	and then the goldbox-compressed records.
+
+	dax_open() maps the archive into memory, and the index is parsed once
+	into an array of records pointing into the mapping, so records are
+	only ever read when they're decompressed. dax_extract_all() decompresses
+	every record in parallel, and dax_build() compresses a whole set of
+	records into a new archive, also in parallel.
+
+	See https://github.com/eloj/rle-zoo
+*/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stddef.h>
+#if defined(_MSC_VER)
+#include <BaseTsd.h>
+typedef SSIZE_T ssize_t;
+#else
+#include <sys/types.h> // ssize_t
+#endif
+#include "rle_goldbox.h"
+
+#define DAX_RECORD_SIZE 9
+#define DAX_MAX_RECORD_LEN 0xFFFF
+
+struct dax_record {
+	unsigned int id;
+	size_t offset;	// From the start of the data, after the index.
+	size_t raw_size;
+	size_t comp_size;
+	const uint8_t *data;	// The compressed record, or for dax_build() the raw record.
+};
+
+struct dax_archive {
+	const uint8_t *base;
+	size_t len;
+	struct dax_record *records;
+	size_t nrecords;
+	int owned;	// Set by dax_open(), which maps (or reads) `base`.
+};
+
+int dax_parse(struct dax_archive *dax, const uint8_t *src, size_t slen);
+int dax_open(struct dax_archive *dax, const char *filename);
+void dax_close(struct dax_archive *dax);
+ssize_t dax_find(const struct dax_archive *dax, unsigned int id);
+ssize_t dax_extract(const struct dax_archive *dax, size_t index, uint8_t *dest, size_t dlen);
+size_t dax_extract_all(const struct dax_archive *dax, uint8_t *const *dests, ssize_t *results);
+ssize_t dax_build(struct dax_record *records, size_t n, uint8_t *dest, size_t dlen);
+
+#if defined(RLE_ZOO_GOLDBOX_DAX_IMPLEMENTATION) || defined(RLE_ZOO_IMPLEMENTATION)
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+#include "rle_image.h"
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#include <stdio.h>
+#endif
+
+static_assert(sizeof(size_t) == sizeof(ssize_t), "");
+
+static inline size_t dax_le16(const uint8_t *p) {
+	return (size_t)p[0] | (size_t)p[1] << 8;
+}
+
+static inline size_t dax_le32(const uint8_t *p) {
+	return (size_t)p[0] | (size_t)p[1] << 8 | (size_t)p[2] << 16 | (size_t)p[3] << 24;
+}
+
+// Parse the index of the archive in `src`, which must stay valid until dax_close().
+// Returns 0 on success, or -1 if the input isn't a DAX archive or memory can't be allocated.
+int dax_parse(struct dax_archive *dax, const uint8_t *src, size_t slen) {
+	memset(dax, 0, sizeof(*dax));
+	if (slen < 2)
+		return -1;
+	size_t index_len = dax_le16(src);
+	if (index_len % DAX_RECORD_SIZE != 0 || index_len > slen - 2)
+		return -1;
+
+	const size_t n = index_len / DAX_RECORD_SIZE;
+	const uint8_t *data = src + 2 + index_len;
+	const size_t data_len = slen - 2 - index_len;
+
+	struct dax_record *records = (struct dax_record *)malloc((n ? n : 1) * sizeof(*records));
+	if (!records)
+		return -1;
+	for (size_t i = 0 ; i < n ; ++i) {
+		const uint8_t *p = src + 2 + i * DAX_RECORD_SIZE;
+		struct dax_record *rec = &records[i];
+		rec->id = p[0];
+		rec->offset = dax_le32(p + 1);
+		rec->raw_size = dax_le16(p + 5);
+		rec->comp_size = dax_le16(p + 7);
+		if (rec->offset > data_len || rec->comp_size > data_len - rec->offset) {
+			free(records);
+			return -1;
+		}
+		rec->data = data + rec->offset;
+	}
+
+	dax->base = src;
+	dax->len = slen;
+	dax->records = records;
+	dax->nrecords = n;
+	return 0;
+}
+
+// Map `filename` into memory and parse it. Returns 0 on success, or -1 on error.
+int dax_open(struct dax_archive *dax, const char *filename) {
+#if !defined(_WIN32)
+	int fd = open(filename, O_RDONLY);
+	if (fd < 0)
+		return -1;
+	struct stat st;
+	if (fstat(fd, &st) != 0 || st.st_size <= 0) {
+		close(fd);
+		return -1;
+	}
+	size_t len = (size_t)st.st_size;
+	void *base = mmap(NULL, len, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (base == MAP_FAILED)
+		return -1;
+	if (dax_parse(dax, (const uint8_t *)base, len) != 0) {
+		munmap(base, len);
+		return -1;
+	}
+#else
+	// No mapping here, so read the whole archive instead.
+	FILE *f = fopen(filename, "rb");
+	if (!f)
+		return -1;
+	uint8_t *base = NULL;
+	long len = -1;
+	if (fseek(f, 0, SEEK_END) == 0 && (len = ftell(f)) > 0 && fseek(f, 0, SEEK_SET) == 0)
+		base = (uint8_t *)malloc((size_t)len);
+	if (!base || fread(base, 1, (size_t)len, f) != (size_t)len || dax_parse(dax, base, (size_t)len) != 0) {
+		free(base);
+		fclose(f);
+		return -1;
+	}
+	fclose(f);
+#endif
+	dax->owned = 1;
+	return 0;
+}
+
+// Release the index, and the archive itself if it was opened by dax_open().
+void dax_close(struct dax_archive *dax) {
+	if (dax->owned) {
+#if !defined(_WIN32)
+		munmap((void *)(uintptr_t)dax->base, dax->len);
+#else
+		free((void *)(uintptr_t)dax->base);
+#endif
+	}
+	free(dax->records);
+	memset(dax, 0, sizeof(*dax));
+}
+
+// Returns the index of the first record with `id`, or -1 if there is none.
+ssize_t dax_find(const struct dax_archive *dax, unsigned int id) {
+	for (size_t i = 0 ; i < dax->nrecords ; ++i) {
+		if (dax->records[i].id == id)
+			return (ssize_t)i;
+	}
+	return -1;
+}
+
+// Decompress record `index` into `dest`, or if `dest` is NULL, return the size needed.
+// Returns the size of the record, or an error as goldbox_decompress() does, or -1
+// if the record doesn't decompress to the size given in the index.
+ssize_t dax_extract(const struct dax_archive *dax, size_t index, uint8_t *dest, size_t dlen) {
+	if (index >= dax->nrecords)
+		return -1;
+	const struct dax_record *rec = &dax->records[index];
+	if (!dest)
+		return (ssize_t)rec->raw_size;
+	ssize_t res = goldbox_decompress(rec->data, rec->comp_size, dest, dlen);
+	if (res >= 0 && (size_t)res != rec->raw_size)
+		return -1;
+	return res;
+}
+
+struct dax_extract_ctx {
+	const struct dax_archive *dax;
+	uint8_t *const *dests;
+	ssize_t *results;
+};
+
+static void dax_extract_records(void *arg, size_t begin, size_t end) {
+	const struct dax_extract_ctx *ctx = (const struct dax_extract_ctx *)arg;
+	for (size_t i = begin ; i < end ; ++i) {
+		ctx->results[i] = dax_extract(ctx->dax, i, ctx->dests[i], ctx->dax->records[i].raw_size);
+	}
+}
+
+// Decompress every record in parallel, record `i` into `dests[i]`, which must hold `raw_size` bytes,
+// storing the return value of dax_extract() in `results[i]`.
+// Returns the number of records that failed to decompress.
+size_t dax_extract_all(const struct dax_archive *dax, uint8_t *const *dests, ssize_t *results) {
+	struct dax_extract_ctx ctx = { dax, dests, results };
+
+	rle_image_parallel_for(dax->nrecords, 16, dax_extract_records, &ctx);
+
+	size_t failed = 0;
+	for (size_t i = 0 ; i < dax->nrecords ; ++i) {
+		if (results[i] < 0)
+			++failed;
+	}
+	return failed;
+}
+
+struct dax_build_ctx {
+	struct dax_record *records;
+	uint8_t *dest;	// Start of the data, or NULL when measuring.
+};
+
+static void dax_compress_records(void *arg, size_t begin, size_t end) {
+	const struct dax_build_ctx *ctx = (const struct dax_build_ctx *)arg;
+	for (size_t i = begin ; i < end ; ++i) {
+		struct dax_record *rec = &ctx->records[i];
+		uint8_t *out = ctx->dest ? ctx->dest + rec->offset : NULL;
+		ssize_t res = goldbox_compress(rec->data, rec->raw_size, out, rec->comp_size);
+		assert(res >= 0);
+		rec->comp_size = (size_t)res;
+	}
+}
+
+// Compress `n` records, each `raw_size` bytes of raw data at `data`, into a new archive in `dest`,
+// or if `dest` is NULL, just return the size needed. Fills in `offset` and `comp_size` of each record.
+// Returns the size of the archive, or -1 if the records don't fit in the format or in `dlen` bytes.
+ssize_t dax_build(struct dax_record *records, size_t n, uint8_t *dest, size_t dlen) {
+	const size_t index_len = n * DAX_RECORD_SIZE;
+	if (n > DAX_MAX_RECORD_LEN / DAX_RECORD_SIZE)
+		return -1;
+	for (size_t i = 0 ; i < n ; ++i) {
+		if (records[i].id > 0xFF || records[i].raw_size > DAX_MAX_RECORD_LEN)
+			return -1;
+	}
+
+	// Measure every record in parallel, then compress each straight into its place.
+	struct dax_build_ctx ctx = { records, NULL };
+	rle_image_parallel_for(n, 16, dax_compress_records, &ctx);
+
+	size_t data_len = 0;
+	for (size_t i = 0 ; i < n ; ++i) {
+		if (records[i].comp_size > DAX_MAX_RECORD_LEN)
+			return -1;
+		records[i].offset = data_len;
+		data_len += records[i].comp_size;
+	}
+	const size_t total = 2 + index_len + data_len;
+	if (!dest)
+		return (ssize_t)total;
+	if (total > dlen || data_len > 0xFFFFFFFF)
+		return -1;
+
+	dest[0] = (uint8_t)index_len;
+	dest[1] = (uint8_t)(index_len >> 8);
+	for (size_t i = 0 ; i < n ; ++i) {
+		uint8_t *p = dest + 2 + i * DAX_RECORD_SIZE;
+		const struct dax_record *rec = &records[i];
+		p[0] = (uint8_t)rec->id;
+		for (size_t k = 0 ; k < 4 ; ++k)
+			p[1 + k] = (uint8_t)(rec->offset >> (8 * k));
+		p[5] = (uint8_t)rec->raw_size;
+		p[6] = (uint8_t)(rec->raw_size >> 8);
+		p[7] = (uint8_t)rec->comp_size;
+		p[8] = (uint8_t)(rec->comp_size >> 8);
+	}
+
+	ctx.dest = dest + 2 + index_len;
+	rle_image_parallel_for(n, 16, dax_compress_records, &ctx);
+
+	return (ssize_t)total;
+}
+#endif
+
+#ifdef __cplusplus
+}
+#endif
@@ -19,6 +19,7 @@ typedef SSIZE_T ssize_t;
 
 ssize_t icns_compress(const uint8_t *src, size_t slen, uint8_t *dest, size_t dlen);
 ssize_t icns_decompress(const uint8_t *src, size_t slen, uint8_t *dest, size_t dlen);
+ssize_t icns_decompress_xor(const uint8_t *src, size_t slen, uint8_t *dest, size_t dlen);
 
 #if defined(RLE_ZOO_ICNS_IMPLEMENTATION) || defined(RLE_ZOO_IMPLEMENTATION)
 #include <assert.h>
@@ -136,6 +137,58 @@ ssize_t icns_decompress(const uint8_t *src, size_t slen, uint8_t *dest, size_t d
 	assert((dest == NULL) || (wp <= dlen));
 	return (ssize_t)wp;
 }
+
+// Decompress by XORing the output onto the existing contents of `dest`, e.g the previous frame
+// of an animation, for delta-compressed data. A REP of zero leaves `dest` as-is, and is skipped.
+ssize_t icns_decompress_xor(const uint8_t *src, size_t slen, uint8_t *dest, size_t dlen) {
+	size_t wp = 0;
+	size_t rp = 0;
+	while (rp < slen) {
+		assert((ssize_t)wp >= 0);
+		assert((ssize_t)rp >= 0);
+
+		uint8_t cnt = 0;
+		uint8_t b = src[rp++];
+		if (b & 0x80) {
+			// REP
+			cnt = (b & 0x7F) + 3;
+			if (!(rp < slen)) {
+				RLE_ZOO_RETURN_ERR;
+			}
+			if (dest) {
+				if (wp + cnt <= dlen) {
+					uint8_t v = src[rp];
+					if (v != 0) {
+						for (unsigned int i = 0 ; i < cnt ; ++i)
+							dest[wp + i] ^= v;
+					}
+				} else {
+					RLE_ZOO_RETURN_ERR;
+				}
+			}
+			++rp;
+		} else {
+			// CPY
+			cnt = b + 1;
+			if (!(rp + cnt <= slen)) {
+				RLE_ZOO_RETURN_ERR;
+			}
+			if (dest) {
+				if (wp + cnt <= dlen) {
+					for (unsigned int i = 0 ; i < cnt ; ++i)
+						dest[wp + i] ^= src[rp + i];
+				} else {
+					RLE_ZOO_RETURN_ERR;
+				}
+			}
+			rp += cnt;
+		}
+		wp += cnt;
+	}
+	assert(rp == slen);
+	assert((dest == NULL) || (wp <= dlen));
+	return (ssize_t)wp;
+}
 #undef RLE_ZOO_RETURN_ERR
 #endif
 
@@ -0,0 +1,225 @@
+/*
+	Apple ICNS Icon Container Loader
+	Copyright (c) 2022, Eddy L O Jansson. Licensed under The MIT License.
+
+	Finds the RLE-compressed icons in an ICNS file, and decodes them into
+	RGBA. The RGB icon types (is32, il32, ih32 and it32) store the red,
+	green and blue channels one after the other, with alpha coming from a
+	separate 8-bit mask element of the same size (s8mk, l8mk, h8mk and
+	t8mk). The it32 data has a four byte zero prefix. The ic04 and ic05
+	types instead store alpha, red, green and blue, after an 'ARGB' tag.
+
+	Parsing records pointers into the file, so nothing is copied until the
+	channels are decoded into a plane buffer on the stack, from which they
+	are interleaved straight into the output with vector shuffles.
+
+	An icon is at most 64KiB of planes, which is not worth splitting
+	across threads, so icns_decode_rgba_batch() decodes many icons in
+	parallel instead.
+
+	See https://github.com/eloj/rle-zoo
+*/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stddef.h>
+#if defined(_MSC_VER)
+#include <BaseTsd.h>
+typedef SSIZE_T ssize_t;
+#else
+#include <sys/types.h> // ssize_t
+#endif
+
+#define ICNS_TYPE(a, b, c, d) ((uint32_t)(a) << 24 | (uint32_t)(b) << 16 | (uint32_t)(c) << 8 | (uint32_t)(d))
+#define ICNS_MAX_WIDTH 128
+
+struct icns_icon {
+	uint32_t type;	// Element type, e.g ICNS_TYPE('i', 'l', '3', '2')
+	size_t width;	// Icons are square
+	unsigned int nchannels;	// 3 for RGB, 4 for ARGB
+	const uint8_t *data;	// RLE channel data, after any prefix
+	size_t len;
+	const uint8_t *mask;	// `width` * `width` bytes of alpha, or NULL
+};
+
+int icns_parse(const uint8_t *src, size_t slen, struct icns_icon *icons, size_t max_icons);
+ssize_t icns_decode_rgba(const struct icns_icon *icon, uint8_t *dest, ptrdiff_t pitch);
+size_t icns_decode_rgba_batch(const struct icns_icon *icons, size_t n, uint8_t *const *dests, ssize_t *results);
+
+#if defined(RLE_ZOO_ICNS_IMAGE_IMPLEMENTATION) || defined(RLE_ZOO_IMPLEMENTATION)
+#include <assert.h>
+#include <string.h>
+#include "rle_image.h"
+
+static_assert(sizeof(size_t) == sizeof(ssize_t), "");
+
+// return -(rp + 1) ... mask so it can't flip positive. Give up and just always return -1?
+#define RLE_ZOO_RETURN_ERR return ~(rp & ((size_t)~0 >> 1UL))
+
+static inline size_t icns_be32(const uint8_t *p) {
+	return (size_t)p[0] << 24 | (size_t)p[1] << 16 | (size_t)p[2] << 8 | (size_t)p[3];
+}
+
+struct icns_kind {
+	uint32_t type;
+	uint32_t mask_type;
+	size_t width;
+	unsigned int nchannels;
+	size_t prefix;
+};
+
+static const struct icns_kind icns_kinds[] = {
+	{ ICNS_TYPE('i', 's', '3', '2'), ICNS_TYPE('s', '8', 'm', 'k'), 16, 3, 0 },
+	{ ICNS_TYPE('i', 'l', '3', '2'), ICNS_TYPE('l', '8', 'm', 'k'), 32, 3, 0 },
+	{ ICNS_TYPE('i', 'h', '3', '2'), ICNS_TYPE('h', '8', 'm', 'k'), 48, 3, 0 },
+	{ ICNS_TYPE('i', 't', '3', '2'), ICNS_TYPE('t', '8', 'm', 'k'), 128, 3, 4 },
+	{ ICNS_TYPE('i', 'c', '0', '4'), 0, 16, 4, 4 },
+	{ ICNS_TYPE('i', 'c', '0', '5'), 0, 32, 4, 4 },
+};
+
+// Find the mask element of `type` and `width` in the file, or return NULL.
+static const uint8_t *icns_find_mask(const uint8_t *src, size_t slen, uint32_t type, size_t width) {
+	size_t rp = 8;
+	while (rp + 8 <= slen) {
+		size_t len = icns_be32(src + rp + 4);
+		if (len < 8 || len > slen - rp)
+			break;
+		if (icns_be32(src + rp) == type && len - 8 >= width * width)
+			return src + rp + 8;
+		rp += len;
+	}
+	return NULL;
+}
+
+// Fill in up to `max_icons` icons found in the file, and return how many were found in total,
+// or -1 if the input isn't an ICNS file. Elements of other types, e.g PNG, are skipped.
+int icns_parse(const uint8_t *src, size_t slen, struct icns_icon *icons, size_t max_icons) {
+	if (slen < 8 || icns_be32(src) != ICNS_TYPE('i', 'c', 'n', 's'))
+		return -1;
+	// Trust the smaller of the file length and the length in the header.
+	if (icns_be32(src + 4) < slen)
+		slen = icns_be32(src + 4);
+
+	int found = 0;
+	size_t rp = 8;
+	while (rp + 8 <= slen) {
+		uint32_t type = (uint32_t)icns_be32(src + rp);
+		size_t len = icns_be32(src + rp + 4);
+		if (len < 8 || len > slen - rp)
+			return -1;
+
+		for (size_t k = 0 ; k < sizeof(icns_kinds)/sizeof(icns_kinds[0]) ; ++k) {
+			const struct icns_kind *kind = &icns_kinds[k];
+			if (type != kind->type || len - 8 < kind->prefix)
+				continue;
+			const uint8_t *data = src + rp + 8;
+			// ARGB types may also hold PNG data, which is not for us.
+			if (kind->nchannels == 4 && memcmp(data, "ARGB", 4) != 0)
+				continue;
+			if ((size_t)found < max_icons) {
+				struct icns_icon *icon = &icons[found];
+				icon->type = type;
+				icon->width = kind->width;
+				icon->nchannels = kind->nchannels;
+				icon->data = data + kind->prefix;
+				icon->len = len - 8 - kind->prefix;
+				icon->mask = kind->mask_type ? icns_find_mask(src, slen, kind->mask_type, kind->width) : NULL;
+			}
+			++found;
+		}
+		rp += len;
+	}
+	return found;
+}
+
+// Decode `icon` into RGBA rows of `width` pixels, `pitch` bytes apart.
+// Returns the number of bytes of channel data consumed.
+ssize_t icns_decode_rgba(const struct icns_icon *icon, uint8_t *dest, ptrdiff_t pitch) {
+	uint8_t planes[4 * ICNS_MAX_WIDTH * ICNS_MAX_WIDTH];
+	const size_t width = icon->width;
+	const size_t n = width * width;
+	const size_t total = icon->nchannels * n;
+	const size_t slen = icon->len;
+	const uint8_t *src = icon->data;
+	size_t rp = 0;
+	size_t wp = 0;
+
+	if (width > ICNS_MAX_WIDTH || (icon->nchannels != 3 && icon->nchannels != 4))
+		return -1;
+
+	// The channels are RLE-compressed back to back. This is icns_decompress(), but stopping at the end of
+	// the channels, and filling and copying whole runs at once.
+	while (wp < total) {
+		if (!(rp < slen)) {
+			RLE_ZOO_RETURN_ERR;
+		}
+		uint8_t b = src[rp++];
+		if (b & 0x80) {
+			// REP
+			size_t cnt = (size_t)(b & 0x7F) + 3;
+			if (!(rp < slen) || cnt > total - wp) {
+				RLE_ZOO_RETURN_ERR;
+			}
+			memset(planes + wp, src[rp++], cnt);
+			wp += cnt;
+		} else {
+			// CPY
+			size_t cnt = (size_t)b + 1;
+			if (!(rp + cnt <= slen) || cnt > total - wp) {
+				RLE_ZOO_RETURN_ERR;
+			}
+			memcpy(planes + wp, src + rp, cnt);
+			rp += cnt;
+			wp += cnt;
+		}
+	}
+
+	for (size_t y = 0 ; y < width ; ++y) {
+		uint8_t *row = dest + (ptrdiff_t)y * pitch;
+		const uint8_t *p = planes + y * width;
+		if (icon->nchannels == 4) {
+			rle_image_interleave4(row, p + n, p + 2 * n, p + 3 * n, p, width);
+		} else {
+			rle_image_interleave4(row, p, p + n, p + 2 * n, icon->mask ? icon->mask + y * width : NULL, width);
+		}
+	}
+	return (ssize_t)rp;
+}
+
+struct icns_batch_ctx {
+	const struct icns_icon *icons;
+	uint8_t *const *dests;
+	ssize_t *results;
+};
+
+static void icns_decode_icons(void *arg, size_t begin, size_t end) {
+	const struct icns_batch_ctx *ctx = (const struct icns_batch_ctx *)arg;
+	for (size_t i = begin ; i < end ; ++i) {
+		const struct icns_icon *icon = &ctx->icons[i];
+		ctx->results[i] = icns_decode_rgba(icon, ctx->dests[i], (ptrdiff_t)(4 * icon->width));
+	}
+}
+
+// Decode `n` icons in parallel, each into tightly packed RGBA at `dests[i]`, storing the
+// return value of icns_decode_rgba() for each in `results[i]`.
+// Returns the number of icons that failed to decode.
+size_t icns_decode_rgba_batch(const struct icns_icon *icons, size_t n, uint8_t *const *dests, ssize_t *results) {
+	struct icns_batch_ctx ctx = { icons, dests, results };
+
+	rle_image_parallel_for(n, 16, icns_decode_icons, &ctx);
+
+	size_t failed = 0;
+	for (size_t i = 0 ; i < n ; ++i) {
+		if (results[i] < 0)
+			++failed;
+	}
+	return failed;
+}
+#undef RLE_ZOO_RETURN_ERR
+#endif
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,261 @@
+/*
+	EA IFF ILBM Image Loader
+	Copyright (c) 2022, Eddy L O Jansson. Licensed under The MIT License.
+
+	Parses the FORM, BMHD, CMAP and BODY chunks of an IFF ILBM file, and
+	decodes the BODY into chunky 8-bit pixels, one byte per pixel.
+
+	Each row of the BODY holds one row of every bitplane, and optionally
+	of a mask plane, each row padded to a multiple of 16 bits. Compressed
+	files use ByteRun1, which is the packbits encoding.
+
+	Rows are decoded one at a time into a small buffer, from which the
+	bitplanes are converted into chunky pixels straight away, while the row
+	is still in cache, so there is never a planar copy of the whole image.
+	The conversion is a bit-matrix transpose of eight planes by sixteen
+	pixels at a time, using SSE2 when the compiler targets it.
+
+	See https://github.com/eloj/rle-zoo
+*/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stddef.h>
+#if defined(_MSC_VER)
+#include <BaseTsd.h>
+typedef SSIZE_T ssize_t;
+#else
+#include <sys/types.h> // ssize_t
+#endif
+
+enum ilbm_masking {
+	ILBM_MASK_NONE,
+	ILBM_MASK_HAS_MASK,	// An extra mask plane follows the bitplanes of every row.
+	ILBM_MASK_TRANSPARENT_COLOR,
+	ILBM_MASK_LASSO,
+};
+
+enum ilbm_compression {
+	ILBM_COMPRESSION_NONE,
+	ILBM_COMPRESSION_BYTERUN1,
+};
+
+struct ilbm_image {
+	size_t width;
+	size_t height;
+	unsigned int nplanes;
+	unsigned int masking;
+	unsigned int compression;
+	unsigned int transparent_color;
+	const uint8_t *cmap;	// `cmap_entries` RGB entries, or NULL.
+	size_t cmap_entries;
+	const uint8_t *body;
+	size_t body_len;
+};
+
+int ilbm_image_parse(const uint8_t *src, size_t slen, struct ilbm_image *img);
+ssize_t ilbm_image_decode(const struct ilbm_image *img, uint8_t *dest, ptrdiff_t pitch);
+
+#if defined(RLE_ZOO_ILBM_IMAGE_IMPLEMENTATION) || defined(RLE_ZOO_IMPLEMENTATION)
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+#include "rle_image.h"
+
+static_assert(sizeof(size_t) == sizeof(ssize_t), "");
+
+// return -(rp + 1) ... mask so it can't flip positive. Give up and just always return -1?
+#define RLE_ZOO_RETURN_ERR return ~(rp & ((size_t)~0 >> 1UL))
+
+#define ILBM_ID(a, b, c, d) ((uint32_t)(a) << 24 | (uint32_t)(b) << 16 | (uint32_t)(c) << 8 | (uint32_t)(d))
+#define ILBM_BMHD_SIZE 20
+
+static inline size_t ilbm_be16(const uint8_t *p) {
+	return (size_t)p[0] << 8 | (size_t)p[1];
+}
+
+static inline size_t ilbm_be32(const uint8_t *p) {
+	return (size_t)p[0] << 24 | (size_t)p[1] << 16 | (size_t)p[2] << 8 | (size_t)p[3];
+}
+
+// Returns 0 on success, or -1 if the input isn't an ILBM file this loader understands.
+// Only images with up to eight bitplanes are supported.
+int ilbm_image_parse(const uint8_t *src, size_t slen, struct ilbm_image *img) {
+	if (slen < 12 || ilbm_be32(src) != ILBM_ID('F', 'O', 'R', 'M') || ilbm_be32(src + 8) != ILBM_ID('I', 'L', 'B', 'M'))
+		return -1;
+	// Trust the smaller of the file length and the length in the header.
+	if (ilbm_be32(src + 4) < slen - 8)
+		slen = ilbm_be32(src + 4) + 8;
+
+	int have_bmhd = 0;
+	img->cmap = NULL;
+	img->cmap_entries = 0;
+	img->body = NULL;
+	img->body_len = 0;
+
+	size_t rp = 12;
+	while (rp + 8 <= slen) {
+		uint32_t id = (uint32_t)ilbm_be32(src + rp);
+		size_t len = ilbm_be32(src + rp + 4);
+		const uint8_t *data = src + rp + 8;
+		rp += 8;
+		// A truncated BODY is left for the decoder to report.
+		if (len > slen - rp) {
+			if (id != ILBM_ID('B', 'O', 'D', 'Y'))
+				return -1;
+			len = slen - rp;
+		}
+
+		if (id == ILBM_ID('B', 'M', 'H', 'D')) {
+			if (len < ILBM_BMHD_SIZE)
+				return -1;
+			img->width = ilbm_be16(data + 0);
+			img->height = ilbm_be16(data + 2);
+			img->nplanes = data[8];
+			img->masking = data[9];
+			img->compression = data[10];
+			img->transparent_color = (unsigned int)ilbm_be16(data + 12);
+			have_bmhd = 1;
+		} else if (id == ILBM_ID('C', 'M', 'A', 'P')) {
+			img->cmap = data;
+			img->cmap_entries = len / 3;
+		} else if (id == ILBM_ID('B', 'O', 'D', 'Y')) {
+			img->body = data;
+			img->body_len = len;
+			break;
+		}
+		// Chunks are padded to an even length.
+		rp += len + (len & 1);
+	}
+
+	if (!have_bmhd || !img->body)
+		return -1;
+	if (img->nplanes == 0 || img->nplanes > 8)
+		return -1;
+	if (img->compression != ILBM_COMPRESSION_NONE && img->compression != ILBM_COMPRESSION_BYTERUN1)
+		return -1;
+
+	return 0;
+}
+
+// Decode exactly `dlen` bytes of ByteRun1 into `dest`, and return the number of bytes consumed.
+// Runs may not extend past `dlen`.
+static ssize_t ilbm_unpack_row(const uint8_t *src, size_t slen, uint8_t *dest, size_t dlen) {
+	size_t rp = 0;
+	size_t wp = 0;
+	while (wp < dlen) {
+		if (!(rp < slen)) {
+			RLE_ZOO_RETURN_ERR;
+		}
+		uint8_t b = src[rp++];
+		if (b > 0x80) {
+			// REP
+			size_t cnt = (size_t)(257 - b);
+			if (!(rp < slen) || cnt > dlen - wp) {
+				RLE_ZOO_RETURN_ERR;
+			}
+			memset(dest + wp, src[rp++], cnt);
+			wp += cnt;
+		} else if (b < 0x80) {
+			// CPY
+			size_t cnt = (size_t)b + 1;
+			if (!(rp + cnt <= slen) || cnt > dlen - wp) {
+				RLE_ZOO_RETURN_ERR;
+			}
+			memcpy(dest + wp, src + rp, cnt);
+			rp += cnt;
+			wp += cnt;
+		} // else b == 0x80: NOP
+	}
+	return (ssize_t)rp;
+}
+
+// Convert `width` pixels of `nplanes` bitplanes, `stride` bytes apart, into chunky pixels.
+static void ilbm_planar_to_chunky(uint8_t *dest, const uint8_t *planes, size_t stride, unsigned int nplanes, size_t width) {
+	size_t x = 0;
+#if defined(RLE_ZOO_IMAGE_SSE2)
+	// Gather two bytes from every plane into an 8x16 bit-matrix, with the planes of the first
+	// eight pixels in the low half. Then each movemask picks out one bit from every byte, which
+	// is one pixel from each half, and shifting moves the next bit up for the next pixel.
+	for ( ; x + 16 <= width ; x += 16) {
+		uint8_t m[16] = { 0 };
+		for (unsigned int p = 0 ; p < nplanes ; ++p) {
+			m[p] = planes[p * stride + x / 8];
+			m[8 + p] = planes[p * stride + x / 8 + 1];
+		}
+		__m128i v = _mm_loadu_si128((const __m128i *)m);
+		for (size_t i = 0 ; i < 8 ; ++i) {
+			int bits = _mm_movemask_epi8(v);
+			dest[x + i] = (uint8_t)bits;
+			dest[x + 8 + i] = (uint8_t)(bits >> 8);
+			v = _mm_slli_epi64(v, 1);
+		}
+	}
+#endif
+	for ( ; x < width ; ++x) {
+		unsigned int bit = 0x80u >> (x & 7);
+		uint8_t pixel = 0;
+		for (unsigned int p = 0 ; p < nplanes ; ++p) {
+			if (planes[p * stride + x / 8] & bit)
+				pixel |= (uint8_t)(1u << p);
+		}
+		dest[x] = pixel;
+	}
+}
+
+// Decode the BODY into rows of `width` chunky pixels, `pitch` bytes apart. Any mask plane is skipped.
+// Returns the number of bytes of the BODY consumed, or -1 if memory can't be allocated.
+ssize_t ilbm_image_decode(const struct ilbm_image *img, uint8_t *dest, ptrdiff_t pitch) {
+	const size_t stride = ((img->width + 15) / 16) * 2;
+	const size_t nplanes = img->nplanes + (img->masking == ILBM_MASK_HAS_MASK ? 1 : 0);
+	const size_t rowlen = nplanes * stride;
+	const uint8_t *src = img->body;
+	const size_t slen = img->body_len;
+	size_t rp = 0;
+
+	if (img->height == 0 || img->width == 0)
+		return 0;
+
+	uint8_t *row = NULL;
+	if (img->compression == ILBM_COMPRESSION_BYTERUN1) {
+		row = (uint8_t *)malloc(rowlen);
+		if (!row)
+			return -1;
+	}
+
+	for (size_t y = 0 ; y < img->height ; ++y) {
+		assert((ssize_t)rp >= 0);
+		const uint8_t *planes = src + rp;
+		if (row) {
+			ssize_t res = ilbm_unpack_row(src + rp, slen - rp, row, rowlen);
+			if (res < 0) {
+				free(row);
+				rp += (size_t)(-(res + 1));
+				RLE_ZOO_RETURN_ERR;
+			}
+			planes = row;
+			rp += (size_t)res;
+		} else {
+			if (rowlen > slen - rp) {
+				rp = slen;
+				RLE_ZOO_RETURN_ERR;
+			}
+			rp += rowlen;
+		}
+		ilbm_planar_to_chunky(dest + (ptrdiff_t)y * pitch, planes, stride, img->nplanes, img->width);
+	}
+
+	free(row);
+	assert(rp <= slen);
+	return (ssize_t)rp;
+}
+#undef ILBM_ID
+#undef ILBM_BMHD_SIZE
+#undef RLE_ZOO_RETURN_ERR
+#endif
+
+#ifdef __cplusplus
+}
+#endif
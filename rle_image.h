@@ -0,0 +1,183 @@
+/*
+	Shared Helpers for the RLE Zoo Image Decoders
+	Copyright (c) 2022, Eddy L O Jansson. Licensed under The MIT License.
+
+	This is included by the implementation of the image and container
+	decoders, and is not meant to be used on its own. Everything in here
+	is static, so it can be included any number of times.
+
+	Work is split into contiguous bands which are run on separate threads.
+	Define RLE_ZOO_NO_THREADS to run all bands on the calling thread, or
+	RLE_ZOO_THREADS to a fixed thread count instead of one per online CPU.
+
+	The plane interleavers use SSE2/SSSE3 when the compiler targets them,
+	with a plain C fallback.
+
+	See https://github.com/eloj/rle-zoo
+*/
+#ifndef RLE_ZOO_IMAGE_H
+#define RLE_ZOO_IMAGE_H
+
+#include <stdint.h>
+#include <stddef.h>
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define RLE_ZOO_IMAGE_SSE2
+#endif
+#if defined(__SSSE3__)
+#include <tmmintrin.h>
+#define RLE_ZOO_IMAGE_SSSE3
+#endif
+#if !defined(RLE_ZOO_NO_THREADS) && !defined(_WIN32)
+#define RLE_ZOO_IMAGE_PTHREADS
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef RLE_ZOO_MAX_THREADS
+#define RLE_ZOO_MAX_THREADS 64
+#endif
+
+// Process items [begin, end).
+typedef void (*rle_image_band_fn)(void *ctx, size_t begin, size_t end);
+
+struct rle_image_band {
+	rle_image_band_fn fn;
+	void *ctx;
+	size_t begin;
+	size_t end;
+};
+
+static inline size_t rle_image_num_threads(void) {
+#if defined(RLE_ZOO_THREADS)
+	return RLE_ZOO_THREADS;
+#elif defined(RLE_ZOO_IMAGE_PTHREADS)
+	long n = sysconf(_SC_NPROCESSORS_ONLN);
+	return n > 0 ? (size_t)n : 1;
+#else
+	return 1;
+#endif
+}
+
+#if defined(RLE_ZOO_IMAGE_PTHREADS)
+static inline void *rle_image_band_thread(void *arg) {
+	struct rle_image_band *band = (struct rle_image_band *)arg;
+	band->fn(band->ctx, band->begin, band->end);
+	return NULL;
+}
+#endif
+
+// Run `fn` over the items [0, n), split into one band per thread, but with no band
+// smaller than `grain` items. The first band runs on the calling thread, and returns
+// when all bands are done. If a thread can't be started, its band runs on the caller.
+static inline void rle_image_parallel_for(size_t n, size_t grain, rle_image_band_fn fn, void *ctx) {
+	if (grain == 0)
+		grain = 1;
+	size_t nbands = rle_image_num_threads();
+	if (nbands > RLE_ZOO_MAX_THREADS)
+		nbands = RLE_ZOO_MAX_THREADS;
+	if (nbands > n / grain)
+		nbands = n / grain;
+	if (nbands <= 1) {
+		if (n > 0)
+			fn(ctx, 0, n);
+		return;
+	}
+
+#if defined(RLE_ZOO_IMAGE_PTHREADS)
+	struct rle_image_band bands[RLE_ZOO_MAX_THREADS];
+	pthread_t tids[RLE_ZOO_MAX_THREADS];
+	int started[RLE_ZOO_MAX_THREADS];
+
+	for (size_t i = 0 ; i < nbands ; ++i) {
+		bands[i].fn = fn;
+		bands[i].ctx = ctx;
+		bands[i].begin = n * i / nbands;
+		bands[i].end = n * (i + 1) / nbands;
+	}
+	for (size_t i = 1 ; i < nbands ; ++i) {
+		started[i] = pthread_create(&tids[i], NULL, rle_image_band_thread, &bands[i]) == 0;
+	}
+	fn(ctx, bands[0].begin, bands[0].end);
+	for (size_t i = 1 ; i < nbands ; ++i) {
+		if (started[i])
+			pthread_join(tids[i], NULL);
+		else
+			fn(ctx, bands[i].begin, bands[i].end);
+	}
+#else
+	fn(ctx, 0, n);
+#endif
+}
+
+// Interleave three planes of `n` bytes each into packed triplets, e.g RGB.
+static inline void rle_image_interleave3(uint8_t *dest, const uint8_t *p0, const uint8_t *p1, const uint8_t *p2, size_t n) {
+	size_t i = 0;
+#if defined(RLE_ZOO_IMAGE_SSSE3)
+	// Each output vector takes a third of a vector of pixels from each plane.
+	const __m128i m00 = _mm_setr_epi8(0, -1, -1, 1, -1, -1, 2, -1, -1, 3, -1, -1, 4, -1, -1, 5);
+	const __m128i m01 = _mm_setr_epi8(-1, 0, -1, -1, 1, -1, -1, 2, -1, -1, 3, -1, -1, 4, -1, -1);
+	const __m128i m02 = _mm_setr_epi8(-1, -1, 0, -1, -1, 1, -1, -1, 2, -1, -1, 3, -1, -1, 4, -1);
+	const __m128i m10 = _mm_setr_epi8(-1, -1, 6, -1, -1, 7, -1, -1, 8, -1, -1, 9, -1, -1, 10, -1);
+	const __m128i m11 = _mm_setr_epi8(5, -1, -1, 6, -1, -1, 7, -1, -1, 8, -1, -1, 9, -1, -1, 10);
+	const __m128i m12 = _mm_setr_epi8(-1, 5, -1, -1, 6, -1, -1, 7, -1, -1, 8, -1, -1, 9, -1, -1);
+	const __m128i m20 = _mm_setr_epi8(-1, 11, -1, -1, 12, -1, -1, 13, -1, -1, 14, -1, -1, 15, -1, -1);
+	const __m128i m21 = _mm_setr_epi8(-1, -1, 11, -1, -1, 12, -1, -1, 13, -1, -1, 14, -1, -1, 15, -1);
+	const __m128i m22 = _mm_setr_epi8(10, -1, -1, 11, -1, -1, 12, -1, -1, 13, -1, -1, 14, -1, -1, 15);
+	for ( ; i + 16 <= n ; i += 16) {
+		__m128i v0 = _mm_loadu_si128((const __m128i *)(p0 + i));
+		__m128i v1 = _mm_loadu_si128((const __m128i *)(p1 + i));
+		__m128i v2 = _mm_loadu_si128((const __m128i *)(p2 + i));
+		__m128i o0 = _mm_or_si128(_mm_or_si128(_mm_shuffle_epi8(v0, m00), _mm_shuffle_epi8(v1, m01)), _mm_shuffle_epi8(v2, m02));
+		__m128i o1 = _mm_or_si128(_mm_or_si128(_mm_shuffle_epi8(v0, m10), _mm_shuffle_epi8(v1, m11)), _mm_shuffle_epi8(v2, m12));
+		__m128i o2 = _mm_or_si128(_mm_or_si128(_mm_shuffle_epi8(v0, m20), _mm_shuffle_epi8(v1, m21)), _mm_shuffle_epi8(v2, m22));
+		_mm_storeu_si128((__m128i *)(dest + 3 * i), o0);
+		_mm_storeu_si128((__m128i *)(dest + 3 * i + 16), o1);
+		_mm_storeu_si128((__m128i *)(dest + 3 * i + 32), o2);
+	}
+#endif
+	for ( ; i < n ; ++i) {
+		dest[3 * i + 0] = p0[i];
+		dest[3 * i + 1] = p1[i];
+		dest[3 * i + 2] = p2[i];
+	}
+}
+
+// Interleave four planes of `n` bytes each into packed quads, e.g RGBA.
+// If `p3` is NULL, the fourth byte of every quad is 0xFF.
+static inline void rle_image_interleave4(uint8_t *dest, const uint8_t *p0, const uint8_t *p1, const uint8_t *p2, const uint8_t *p3, size_t n) {
+	size_t i = 0;
+#if defined(RLE_ZOO_IMAGE_SSE2)
+	const __m128i opaque = _mm_set1_epi8(-1);
+	for ( ; i + 16 <= n ; i += 16) {
+		__m128i v0 = _mm_loadu_si128((const __m128i *)(p0 + i));
+		__m128i v1 = _mm_loadu_si128((const __m128i *)(p1 + i));
+		__m128i v2 = _mm_loadu_si128((const __m128i *)(p2 + i));
+		__m128i v3 = p3 ? _mm_loadu_si128((const __m128i *)(p3 + i)) : opaque;
+		__m128i lo01 = _mm_unpacklo_epi8(v0, v1);
+		__m128i hi01 = _mm_unpackhi_epi8(v0, v1);
+		__m128i lo23 = _mm_unpacklo_epi8(v2, v3);
+		__m128i hi23 = _mm_unpackhi_epi8(v2, v3);
+		_mm_storeu_si128((__m128i *)(dest + 4 * i), _mm_unpacklo_epi16(lo01, lo23));
+		_mm_storeu_si128((__m128i *)(dest + 4 * i + 16), _mm_unpackhi_epi16(lo01, lo23));
+		_mm_storeu_si128((__m128i *)(dest + 4 * i + 32), _mm_unpacklo_epi16(hi01, hi23));
+		_mm_storeu_si128((__m128i *)(dest + 4 * i + 48), _mm_unpackhi_epi16(hi01, hi23));
+	}
+#endif
+	for ( ; i < n ; ++i) {
+		dest[4 * i + 0] = p0[i];
+		dest[4 * i + 1] = p1[i];
+		dest[4 * i + 2] = p2[i];
+		dest[4 * i + 3] = p3 ? p3[i] : 0xFF;
+	}
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
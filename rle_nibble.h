@@ -0,0 +1,439 @@
+/*
+	Run-Length Encoder/Decoder (RLE), Nibble (4-bit) Variants for 16-Colour Images
+	Copyright (c) 2022, Eddy L O Jansson. Licensed under The MIT License.
+
+	These variants count in pixels of four bits, packed two to a byte with
+	the first pixel in the high nibble, so both the input to the encoders
+	and the output of the decoders is packed 4-bpp data.
+
+	nibble_packbits_* uses a PackBits-style op set, and nibble_bmp_rle4_*
+	the op set of Windows BMP RLE4, treating the input as one long scanline
+	the same way bmp_rle8_* does for RLE8.
+
+	Runs are found by comparing 16 pixels at a time within a 64-bit word,
+	and the decoders write whole bytes wherever the output is byte-aligned.
+
+	See https://github.com/eloj/rle-zoo
+*/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stddef.h>
+#if defined(_MSC_VER)
+#include <BaseTsd.h>
+typedef SSIZE_T ssize_t;
+#else
+#include <sys/types.h> // ssize_t
+#endif
+
+ssize_t nibble_packbits_compress(const uint8_t *src, size_t slen, uint8_t *dest, size_t dlen);
+ssize_t nibble_packbits_decompress(const uint8_t *src, size_t slen, uint8_t *dest, size_t dlen);
+ssize_t nibble_bmp_rle4_compress(const uint8_t *src, size_t slen, uint8_t *dest, size_t dlen);
+ssize_t nibble_bmp_rle4_decompress(const uint8_t *src, size_t slen, uint8_t *dest, size_t dlen);
+
+#if defined(RLE_ZOO_NIBBLE_IMPLEMENTATION) || defined(RLE_ZOO_IMPLEMENTATION)
+#include <assert.h>
+#include <string.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+static_assert(sizeof(size_t) == sizeof(ssize_t), "");
+
+// return -(rp + 1) ... mask so it can't flip positive. Give up and just always return -1?
+#define RLE_ZOO_RETURN_ERR return ~(rp & ((size_t)~0 >> 1UL))
+
+enum {
+	NIBBLE_ESC_EOL = 0,
+	NIBBLE_ESC_EOB = 1,
+	NIBBLE_ESC_DELTA = 2,
+};
+
+static inline uint8_t nibble_get(const uint8_t *src, size_t pos) {
+	return (pos & 1) ? (src[pos / 2] & 0x0F) : (uint8_t)(src[pos / 2] >> 4);
+}
+
+// Load up to eight bytes as a big-endian word, zero-padded at the end.
+static inline uint64_t nibble_load_be64(const uint8_t *p, size_t avail) {
+	uint64_t res = 0;
+	for (size_t i = 0 ; i < 8 ; ++i)
+		res = (res << 8) | (i < avail ? p[i] : 0);
+	return res;
+}
+
+static inline void nibble_store_be64(uint8_t *p, uint64_t v) {
+	for (size_t i = 0 ; i < 8 ; ++i)
+		p[i] = (uint8_t)(v >> (56 - 8 * i));
+}
+
+// Index of the first (most significant) flagged nibble; `mask` must be non-zero.
+static inline size_t nibble_first(uint64_t mask) {
+#if defined(_MSC_VER)
+	unsigned long idx;
+	_BitScanReverse64(&idx, mask);
+	return (63 - (size_t)idx) / 4;
+#else
+	return (size_t)__builtin_clzll(mask) / 4;
+#endif
+}
+
+// Set the top bit of every nibble of `x` that is zero. Unlike the usual (x - 0x11..) & ~x
+// trick, no borrow can cross into the next nibble, so every flag is exact.
+static inline uint64_t nibble_zero_mask(uint64_t x) {
+	const uint64_t lo = 0x7777777777777777ULL;
+	return ~(((x & lo) + lo) | x) & 0x8888888888888888ULL;
+}
+
+// Returns the pixels at `pos` onward in a word, first pixel in the top nibble, and the
+// number of those that are actual input in `*valid`.
+static inline uint64_t nibble_fetch(const uint8_t *src, size_t slen, size_t pos, size_t *valid) {
+	size_t k = pos / 2;
+	size_t avail = slen - k;
+	*valid = (avail >= 8 ? 16 : avail * 2) - (pos & 1);
+	return nibble_load_be64(src + k, avail) << (4 * (pos & 1));
+}
+
+// Count the pixels from `pos` onward that equal the pixel `dist` positions after them, up to `max`.
+// A `dist` of one measures plain runs, and a `dist` of two runs of alternating pixel pairs.
+static size_t nibble_match(const uint8_t *src, size_t slen, size_t pos, unsigned int dist, size_t max) {
+	size_t run = 0;
+	while (run < max && pos < slen * 2) {
+		size_t valid;
+		uint64_t w = nibble_fetch(src, slen, pos, &valid);
+		if (valid <= dist)
+			break;
+		size_t cmp = valid - dist;
+		uint64_t diff = ~nibble_zero_mask(w ^ (w << (4 * dist))) & 0x8888888888888888ULL;
+		size_t n = diff ? nibble_first(diff) : 16;
+		if (n < cmp) {
+			run += n;
+			break;
+		}
+		run += cmp;
+		pos += cmp;
+	}
+	return run < max ? run : max;
+}
+
+// Find the first position from `pos` onward where nibble_match() is at least two, i.e
+// a run of three for `dist` one, or of four for `dist` two. Returns `max` if there is none before that.
+static size_t nibble_find_run(const uint8_t *src, size_t slen, size_t pos, unsigned int dist, size_t max) {
+	size_t ofs = 0;
+	while (ofs < max && pos < slen * 2) {
+		size_t valid;
+		uint64_t w = nibble_fetch(src, slen, pos, &valid);
+		if (valid <= dist + 1)
+			break;
+		size_t cmp = valid - dist - 1;
+		uint64_t z = nibble_zero_mask(w ^ (w << (4 * dist)));
+		z &= z << 4;
+		size_t n = z ? nibble_first(z) : 16;
+		if (n < cmp) {
+			ofs += n;
+			return ofs < max ? ofs : max;
+		}
+		ofs += cmp;
+		pos += cmp;
+	}
+	return max;
+}
+
+// Fill `cnt` pixels from pixel `pos` with the pixel pair `pat`, high nibble first.
+// A started byte is completed, and a trailing half byte gets a zero low nibble.
+static void nibble_fill(uint8_t *dest, size_t pos, uint8_t pat, size_t cnt) {
+	if (cnt == 0)
+		return;
+	if (pos & 1) {
+		uint8_t *p = dest + pos / 2;
+		*p = (uint8_t)((*p & 0xF0) | (pat >> 4));
+		pat = (uint8_t)((pat << 4) | (pat >> 4));
+		++pos;
+		--cnt;
+	}
+	memset(dest + pos / 2, pat, cnt / 2);
+	if (cnt & 1)
+		dest[(pos + cnt) / 2] = pat & 0xF0;
+}
+
+// Copy `cnt` pixels from pixel `spos` of `src` to pixel `dpos` of `dest`, with the same
+// completion and padding rules as nibble_fill(). Different alignments are handled by
+// shifting whole words a nibble.
+static void nibble_copy(uint8_t *dest, size_t dpos, const uint8_t *src, size_t spos, size_t cnt) {
+	if (cnt == 0)
+		return;
+	if (dpos & 1) {
+		uint8_t *p = dest + dpos / 2;
+		*p = (uint8_t)((*p & 0xF0) | nibble_get(src, spos));
+		++dpos;
+		++spos;
+		--cnt;
+	}
+	uint8_t *d = dest + dpos / 2;
+	const uint8_t *s = src + spos / 2;
+	size_t n = cnt / 2;
+	if ((spos & 1) == 0) {
+		memcpy(d, s, n);
+		if (cnt & 1)
+			d[n] = s[n] & 0xF0;
+		return;
+	}
+	// Every output byte straddles two input bytes; the last pixel needed is in s[n].
+	size_t i = 0;
+	for ( ; i + 8 <= n ; i += 8)
+		nibble_store_be64(d + i, (nibble_load_be64(s + i, 8) << 4) | (s[i + 8] >> 4));
+	for ( ; i < n ; ++i)
+		d[i] = (uint8_t)((s[i] << 4) | (s[i + 1] >> 4));
+	if (cnt & 1)
+		d[n] = (uint8_t)(s[n] << 4);
+}
+
+// RLE PARAMS: min CPY=1, max CPY=128, min REP=2, max REP=128 (in pixels)
+ssize_t nibble_packbits_compress(const uint8_t *src, size_t slen, uint8_t *dest, size_t dlen) {
+	const size_t npix = slen * 2;
+	size_t rp = 0; // in pixels
+	size_t wp = 0;
+
+	while (rp < npix) {
+		assert((ssize_t)wp >= 0);
+		assert((ssize_t)rp >= 0);
+
+		size_t cnt = 1 + nibble_match(src, slen, rp, 1, 127);
+
+		// Output REP. A REP of two costs as much as a CPY of two, so it's only used for longer runs.
+		if (cnt > 2) {
+			assert(cnt <= 128);
+			if (dest) {
+				if (wp + 2 <= dlen) {
+					dest[wp + 0] = (uint8_t)(257 - cnt);
+					dest[wp + 1] = nibble_get(src, rp);
+				} else {
+					rp /= 2;
+					RLE_ZOO_RETURN_ERR;
+				}
+			}
+			wp += 2;
+			rp += cnt;
+			continue;
+		}
+
+		// Count number of literal pixels, up to 128, stopping short of any run of three.
+		size_t left = npix - rp;
+		cnt = nibble_find_run(src, slen, rp, 1, left < 128 ? left : 128);
+
+		assert(cnt > 0);
+		assert(cnt <= 128);
+
+		// Output CPY
+		size_t len = 1 + (cnt + 1) / 2;
+		if (dest) {
+			if (wp + len <= dlen) {
+				dest[wp] = (uint8_t)(cnt - 1);
+				nibble_copy(dest + wp + 1, 0, src, rp, cnt);
+			} else {
+				rp /= 2;
+				RLE_ZOO_RETURN_ERR;
+			}
+		}
+		rp += cnt;
+		wp += len;
+	}
+	assert(rp == npix);
+	assert((dest == NULL) || (wp <= dlen));
+	return (ssize_t)wp;
+}
+
+ssize_t nibble_packbits_decompress(const uint8_t *src, size_t slen, uint8_t *dest, size_t dlen) {
+	size_t wp = 0; // in pixels
+	size_t rp = 0;
+	while (rp < slen) {
+		assert((ssize_t)wp >= 0);
+		assert((ssize_t)rp >= 0);
+
+		size_t cnt = 0;
+		uint8_t b = src[rp++];
+		if (b > 0x80) {
+			// REP; the pixel is in the low nibble.
+			cnt = (size_t)(257 - b);
+			if (!(rp < slen)) {
+				RLE_ZOO_RETURN_ERR;
+			}
+			if (dest) {
+				if ((wp + cnt + 1) / 2 <= dlen) {
+					nibble_fill(dest, wp, (uint8_t)((src[rp] & 0x0F) * 0x11), cnt);
+				} else {
+					RLE_ZOO_RETURN_ERR;
+				}
+			}
+			++rp;
+		} else if (b < 0x80) {
+			// CPY, padded to a whole byte.
+			cnt = (size_t)b + 1;
+			size_t plen = (cnt + 1) / 2;
+			if (!(rp + plen <= slen)) {
+				RLE_ZOO_RETURN_ERR;
+			}
+			if (dest) {
+				if ((wp + cnt + 1) / 2 <= dlen) {
+					nibble_copy(dest, wp, src + rp, 0, cnt);
+				} else {
+					RLE_ZOO_RETURN_ERR;
+				}
+			}
+			rp += plen;
+		}
+		wp += cnt;
+	}
+
+	// The output must be a whole number of bytes.
+	if (wp & 1) {
+		RLE_ZOO_RETURN_ERR;
+	}
+
+	assert(rp == slen);
+	assert((dest == NULL) || (wp / 2 <= dlen));
+	return (ssize_t)(wp / 2);
+}
+
+static ssize_t nibble_bmp_rle4_encode(uint8_t *dest, size_t dlen, size_t wp, uint8_t cnt, uint8_t value) {
+	if (dest) {
+		if (wp + 2 <= dlen) {
+			dest[wp + 0] = cnt;
+			dest[wp + 1] = value;
+		} else {
+			return -1;
+		}
+	}
+	return (ssize_t)(wp + 2);
+}
+
+// RLE PARAMS: min REP=1, max REP=255, min ABS=3, max ABS=255 (in pixels)
+// A REP repeats a pair of pixels, so alternating pixels are runs too.
+ssize_t nibble_bmp_rle4_compress(const uint8_t *src, size_t slen, uint8_t *dest, size_t dlen) {
+	const size_t npix = slen * 2;
+	size_t rp = 0; // in pixels
+	size_t wp = 0;
+
+	while (rp < npix) {
+		assert((ssize_t)wp >= 0);
+		assert((ssize_t)rp >= 0);
+
+		size_t left = npix - rp;
+		size_t cnt = (left < 2) ? 1 : 2 + nibble_match(src, slen, rp, 2, 253);
+
+		if (cnt < 4) {
+			// Count number of literal pixels, up to 255, stopping short of any run of four.
+			cnt = nibble_find_run(src, slen, rp, 2, left < 255 ? left : 255);
+			assert(cnt > 0);
+
+			// Output CPY (absolute mode), padded to an even number of bytes.
+			if (cnt >= 3) {
+				size_t plen = (cnt + 1) / 2;
+				size_t len = 2 + plen + (plen & 1);
+				if (dest) {
+					if (wp + len <= dlen) {
+						dest[wp + 0] = 0;
+						dest[wp + 1] = (uint8_t)cnt;
+						nibble_copy(dest + wp + 2, 0, src, rp, cnt);
+						if (plen & 1)
+							dest[wp + 2 + plen] = 0;
+					} else {
+						rp /= 2;
+						RLE_ZOO_RETURN_ERR;
+					}
+				}
+				rp += cnt;
+				wp += len;
+				continue;
+			}
+		}
+
+		// Output REP, also used for literals too short for absolute mode.
+		assert(cnt <= 255);
+		uint8_t pat = (uint8_t)(nibble_get(src, rp) << 4);
+		if (cnt > 1)
+			pat |= nibble_get(src, rp + 1);
+		ssize_t res = nibble_bmp_rle4_encode(dest, dlen, wp, (uint8_t)cnt, pat);
+		if (res < 0) {
+			rp /= 2;
+			RLE_ZOO_RETURN_ERR;
+		}
+		wp = (size_t)res;
+		rp += cnt;
+	}
+	assert(rp == npix);
+
+	ssize_t res = nibble_bmp_rle4_encode(dest, dlen, wp, 0, NIBBLE_ESC_EOB);
+	if (res < 0) {
+		rp = slen;
+		RLE_ZOO_RETURN_ERR;
+	}
+	assert((dest == NULL) || ((size_t)res <= dlen));
+	return res;
+}
+
+// Decodes until end-of-bitmap or end of input, whichever comes first. End-of-line is a no-op,
+// and a delta is an error, since there are no lines.
+ssize_t nibble_bmp_rle4_decompress(const uint8_t *src, size_t slen, uint8_t *dest, size_t dlen) {
+	size_t wp = 0; // in pixels
+	size_t rp = 0;
+	while (rp < slen) {
+		assert((ssize_t)wp >= 0);
+		assert((ssize_t)rp >= 0);
+
+		size_t cnt = src[rp++];
+		if (!(rp < slen)) {
+			RLE_ZOO_RETURN_ERR;
+		}
+		uint8_t b = src[rp++];
+		if (cnt > 0) {
+			// REP, alternating between the high and low nibble of `b`.
+			if (dest) {
+				if ((wp + cnt + 1) / 2 <= dlen) {
+					nibble_fill(dest, wp, b, cnt);
+				} else {
+					RLE_ZOO_RETURN_ERR;
+				}
+			}
+		} else if (b == NIBBLE_ESC_EOL) {
+			continue;
+		} else if (b == NIBBLE_ESC_EOB) {
+			break;
+		} else if (b == NIBBLE_ESC_DELTA) {
+			RLE_ZOO_RETURN_ERR;
+		} else {
+			// CPY, padded to an even number of bytes.
+			cnt = b;
+			size_t plen = (cnt + 1) / 2;
+			if (!(rp + plen <= slen)) {
+				RLE_ZOO_RETURN_ERR;
+			}
+			if (dest) {
+				if ((wp + cnt + 1) / 2 <= dlen) {
+					nibble_copy(dest, wp, src + rp, 0, cnt);
+				} else {
+					RLE_ZOO_RETURN_ERR;
+				}
+			}
+			rp += plen + (plen & 1);
+			if (rp > slen)
+				rp = slen;
+		}
+		wp += cnt;
+	}
+
+	// The output must be a whole number of bytes.
+	if (wp & 1) {
+		RLE_ZOO_RETURN_ERR;
+	}
+
+	assert((dest == NULL) || (wp / 2 <= dlen));
+	return (ssize_t)(wp / 2);
+}
+#undef RLE_ZOO_RETURN_ERR
+#endif
+
+#ifdef __cplusplus
+}
+#endif
@@ -17,10 +17,16 @@ typedef SSIZE_T ssize_t;
 #include <sys/types.h> // ssize_t
 #endif
 
+// Guarded, since the image loaders built on packbits include this header too.
+#ifndef RLE_ZOO_PACKBITS_H
+#define RLE_ZOO_PACKBITS_H
 ssize_t packbits_compress(const uint8_t *src, size_t slen, uint8_t *dest, size_t dlen);
 ssize_t packbits_decompress(const uint8_t *src, size_t slen, uint8_t *dest, size_t dlen);
+ssize_t packbits_decompress_xor(const uint8_t *src, size_t slen, uint8_t *dest, size_t dlen);
+#endif
 
-#if defined(RLE_ZOO_PACKBITS_IMPLEMENTATION) || defined(RLE_ZOO_IMPLEMENTATION)
+#if (defined(RLE_ZOO_PACKBITS_IMPLEMENTATION) || defined(RLE_ZOO_IMPLEMENTATION)) && !defined(RLE_ZOO_PACKBITS_IMPLEMENTED)
+#define RLE_ZOO_PACKBITS_IMPLEMENTED
 #include <assert.h>
 
 static_assert(sizeof(size_t) == sizeof(ssize_t), "");
@@ -130,6 +136,58 @@ ssize_t packbits_decompress(const uint8_t *src, size_t slen, uint8_t *dest, size
 	assert((dest == NULL) || (wp <= dlen));
 	return (ssize_t)wp;
 }
+
+// Decompress by XORing the output onto the existing contents of `dest`, e.g the previous frame
+// of an animation, for delta-compressed data. A REP of zero leaves `dest` as-is, and is skipped.
+ssize_t packbits_decompress_xor(const uint8_t *src, size_t slen, uint8_t *dest, size_t dlen) {
+	size_t wp = 0;
+	size_t rp = 0;
+	while (rp < slen) {
+		assert((ssize_t)wp >= 0);
+		assert((ssize_t)rp >= 0);
+
+		uint8_t cnt = 0;
+		uint8_t b = src[rp++];
+		if (b > 0x80) {
+			// REP
+			cnt = (uint8_t)(257 - b);
+			if (!(rp < slen)) {
+				RLE_ZOO_RETURN_ERR;
+			}
+			if (dest) {
+				if (wp + cnt <= dlen) {
+					uint8_t v = src[rp];
+					if (v != 0) {
+						for (unsigned int i = 0 ; i < cnt ; ++i)
+							dest[wp + i] ^= v;
+					}
+				} else {
+					RLE_ZOO_RETURN_ERR;
+				}
+			}
+			++rp;
+		} else if (b < 0x80) {
+			// CPY
+			cnt = b + 1;
+			if (!(rp + cnt <= slen)) {
+				RLE_ZOO_RETURN_ERR;
+			}
+			if (dest) {
+				if (wp + cnt <= dlen) {
+					for (unsigned int i = 0 ; i < cnt ; ++i)
+						dest[wp + i] ^= src[rp + i];
+				} else {
+					RLE_ZOO_RETURN_ERR;
+				}
+			}
+			rp += cnt;
+		} // else b == 0x80: Reserved. Just skip byte as suggested by TN1023.
+		wp += cnt;
+	}
+	assert(rp == slen);
+	assert((dest == NULL) || (wp <= dlen));
+	return (ssize_t)wp;
+}
 #undef RLE_ZOO_RETURN_ERR
 #endif
 
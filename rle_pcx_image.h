@@ -0,0 +1,274 @@
+/*
+	ZSoft PCX Image Loader
+	Copyright (c) 2022, Eddy L O Jansson. Licensed under The MIT License.
+
+	Parses the 128-byte PCX header and decodes the RLE image data that
+	follows into a caller-supplied image with an arbitrary pitch.
+
+	Each scanline is `nplanes` planes of `bytes_per_line` bytes each,
+	which may include padding beyond the image width. The loader can output
+	the scanlines as-is, or for 8-bit images as indexed pixels, or with the
+	planes interleaved into packed RGB or RGBA.
+
+	The start of every scanline is found by a quick pass over the op bytes
+	only, after which bands of scanlines are decoded in parallel, each line
+	into a small buffer from which the planes are interleaved into the
+	output. Runs crossing scanlines, which some encoders produce, are fine.
+
+	See https://github.com/eloj/rle-zoo
+*/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stddef.h>
+#if defined(_MSC_VER)
+#include <BaseTsd.h>
+typedef SSIZE_T ssize_t;
+#else
+#include <sys/types.h> // ssize_t
+#endif
+
+#define PCX_HEADER_SIZE 128
+
+enum pcx_format {
+	PCX_FORMAT_RAW,		// nplanes * bytes_per_line bytes per row, as stored.
+	PCX_FORMAT_INDEXED,	// One byte per pixel; one 8-bit plane only.
+	PCX_FORMAT_RGB,		// Three bytes per pixel; three or four 8-bit planes.
+	PCX_FORMAT_RGBA,	// Four bytes per pixel; three or four 8-bit planes. Opaque if there are three.
+};
+
+struct pcx_image {
+	unsigned int version;
+	unsigned int bpp;	// Bits per pixel, per plane.
+	unsigned int nplanes;
+	size_t width;
+	size_t height;
+	size_t bytes_per_line;	// Per plane, including padding.
+	const uint8_t *palette16;	// 16 RGB entries from the header.
+	const uint8_t *palette256;	// 256 RGB entries from the end of the file, or NULL.
+	size_t data_len;	// Bytes of image data following the header.
+};
+
+int pcx_image_parse(const uint8_t *src, size_t slen, struct pcx_image *img);
+size_t pcx_image_rowlen(const struct pcx_image *img, enum pcx_format fmt);
+ssize_t pcx_image_decode(const struct pcx_image *img, const uint8_t *src, size_t slen, enum pcx_format fmt, uint8_t *dest, ptrdiff_t pitch);
+
+#if defined(RLE_ZOO_PCX_IMAGE_IMPLEMENTATION) || defined(RLE_ZOO_IMPLEMENTATION)
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+#include "rle_image.h"
+
+static_assert(sizeof(size_t) == sizeof(ssize_t), "");
+
+// return -(rp + 1) ... mask so it can't flip positive. Give up and just always return -1?
+#define RLE_ZOO_RETURN_ERR return ~(rp & ((size_t)~0 >> 1UL))
+
+// The 256-colour palette of version 5 files is stored after a marker byte at the end of the file.
+#define PCX_PALETTE256_MARKER 0x0C
+#define PCX_PALETTE256_SIZE (1 + 768)
+
+static inline size_t pcx_le16(const uint8_t *p) {
+	return (size_t)p[0] | (size_t)p[1] << 8;
+}
+
+// Returns 0 on success, or -1 if the input isn't a PCX file this loader understands.
+int pcx_image_parse(const uint8_t *src, size_t slen, struct pcx_image *img) {
+	if (slen < PCX_HEADER_SIZE || src[0] != 0x0A || src[2] != 1)
+		return -1;
+
+	size_t xmin = pcx_le16(src + 4);
+	size_t ymin = pcx_le16(src + 6);
+	size_t xmax = pcx_le16(src + 8);
+	size_t ymax = pcx_le16(src + 10);
+	if (xmax < xmin || ymax < ymin)
+		return -1;
+
+	img->version = src[1];
+	img->bpp = src[3];
+	img->nplanes = src[65];
+	img->width = xmax - xmin + 1;
+	img->height = ymax - ymin + 1;
+	img->bytes_per_line = pcx_le16(src + 66);
+	img->palette16 = src + 16;
+	img->palette256 = NULL;
+	img->data_len = slen - PCX_HEADER_SIZE;
+
+	if (img->nplanes == 0 || img->nplanes > 4)
+		return -1;
+	if (img->bpp != 1 && img->bpp != 2 && img->bpp != 4 && img->bpp != 8)
+		return -1;
+	if (img->bytes_per_line * 8 < img->width * img->bpp)
+		return -1;
+
+	if (img->version >= 5 && img->bpp == 8 && img->nplanes == 1 &&
+		img->data_len >= PCX_PALETTE256_SIZE && src[slen - PCX_PALETTE256_SIZE] == PCX_PALETTE256_MARKER) {
+		img->palette256 = src + slen - PCX_PALETTE256_SIZE + 1;
+		img->data_len -= PCX_PALETTE256_SIZE;
+	}
+
+	return 0;
+}
+
+// Returns the number of bytes in an output row, or 0 if the format isn't available for the image.
+size_t pcx_image_rowlen(const struct pcx_image *img, enum pcx_format fmt) {
+	switch (fmt) {
+		case PCX_FORMAT_RAW:
+			return img->nplanes * img->bytes_per_line;
+		case PCX_FORMAT_INDEXED:
+			return (img->bpp == 8 && img->nplanes == 1) ? img->width : 0;
+		case PCX_FORMAT_RGB:
+			return (img->bpp == 8 && img->nplanes >= 3) ? 3 * img->width : 0;
+		case PCX_FORMAT_RGBA:
+			return (img->bpp == 8 && img->nplanes >= 3) ? 4 * img->width : 0;
+	}
+	return 0;
+}
+
+// Where a scanline starts: at the op at `ofs`, minus the first `skip` bytes of its output,
+// which belong to the previous line(s).
+struct pcx_line {
+	size_t ofs;
+	size_t skip;
+	int ok;
+};
+
+struct pcx_image_ctx {
+	const struct pcx_image *img;
+	const uint8_t *src;
+	struct pcx_line *lines;
+	enum pcx_format fmt;
+	uint8_t *dest;
+	ptrdiff_t pitch;
+	size_t linelen;
+};
+
+// Decode one scanline. The input has already been validated by the scan for line starts.
+static void pcx_decode_line(const uint8_t *src, size_t rp, size_t skip, uint8_t *out, size_t linelen) {
+	size_t wp = 0;
+	while (wp < linelen) {
+		size_t cnt = 1;
+		uint8_t b = src[rp++];
+		if ((b & 0xC0) == 0xC0) {
+			cnt = b & 0x3F;
+			b = src[rp++];
+		}
+		cnt -= skip;
+		skip = 0;
+		if (cnt > linelen - wp)
+			cnt = linelen - wp;
+		memset(out + wp, b, cnt);
+		wp += cnt;
+	}
+}
+
+static void pcx_decode_lines(void *arg, size_t begin, size_t end) {
+	const struct pcx_image_ctx *ctx = (const struct pcx_image_ctx *)arg;
+	const size_t bpl = ctx->img->bytes_per_line;
+	const size_t width = ctx->img->width;
+
+	uint8_t *line = NULL;
+	if (ctx->fmt != PCX_FORMAT_RAW) {
+		line = (uint8_t *)malloc(ctx->linelen);
+		if (!line)
+			return;
+	}
+
+	for (size_t y = begin ; y < end ; ++y) {
+		uint8_t *row = ctx->dest + (ptrdiff_t)y * ctx->pitch;
+		pcx_decode_line(ctx->src, ctx->lines[y].ofs, ctx->lines[y].skip, line ? line : row, ctx->linelen);
+		switch (ctx->fmt) {
+			case PCX_FORMAT_RAW:
+				break;
+			case PCX_FORMAT_INDEXED:
+				memcpy(row, line, width);
+				break;
+			case PCX_FORMAT_RGB:
+				rle_image_interleave3(row, line, line + bpl, line + 2 * bpl, width);
+				break;
+			case PCX_FORMAT_RGBA:
+				rle_image_interleave4(row, line, line + bpl, line + 2 * bpl, ctx->img->nplanes > 3 ? line + 3 * bpl : NULL, width);
+				break;
+		}
+		ctx->lines[y].ok = 1;
+	}
+	free(line);
+}
+
+// Decode the image data of `src` (the whole file) into rows `pitch` bytes apart,
+// each pcx_image_rowlen() bytes long. Returns the offset in `src` just past the image data,
+// or -1 if the format isn't available for the image or memory can't be allocated.
+ssize_t pcx_image_decode(const struct pcx_image *img, const uint8_t *src, size_t slen, enum pcx_format fmt, uint8_t *dest, ptrdiff_t pitch) {
+	if (pcx_image_rowlen(img, fmt) == 0 || slen < PCX_HEADER_SIZE + img->data_len)
+		return -1;
+	if (img->height == 0)
+		return PCX_HEADER_SIZE;
+
+	const size_t linelen = img->nplanes * img->bytes_per_line;
+	const size_t height = img->height;
+	const size_t end = PCX_HEADER_SIZE + img->data_len;
+
+	struct pcx_line *lines = (struct pcx_line *)malloc(height * sizeof(*lines));
+	if (!lines)
+		return -1;
+
+	// Find the start of every line by summing op lengths, without producing any output.
+	size_t rp = PCX_HEADER_SIZE;
+	size_t pos = 0;
+	size_t y = 0;
+	lines[0].ofs = rp;
+	lines[0].skip = 0;
+	while (y < height) {
+		if (!(rp < end)) {
+			free(lines);
+			RLE_ZOO_RETURN_ERR;
+		}
+		size_t op = rp;
+		size_t cnt = 1;
+		if ((src[rp++] & 0xC0) == 0xC0) {
+			if (!(rp < end)) {
+				free(lines);
+				RLE_ZOO_RETURN_ERR;
+			}
+			cnt = src[op] & 0x3F;
+			++rp;
+		}
+		pos += cnt;
+		while (pos >= linelen && y < height) {
+			pos -= linelen;
+			if (++y < height) {
+				lines[y].ofs = pos ? op : rp;
+				lines[y].skip = pos ? cnt - pos : 0;
+			}
+		}
+	}
+	if (pos != 0) {
+		// The last run overruns the image.
+		free(lines);
+		RLE_ZOO_RETURN_ERR;
+	}
+
+	for (y = 0 ; y < height ; ++y)
+		lines[y].ok = 0;
+
+	struct pcx_image_ctx ctx = { img, src, lines, fmt, dest, pitch, linelen };
+	rle_image_parallel_for(height, 1 + 65536 / (linelen + 1), pcx_decode_lines, &ctx);
+
+	ssize_t res = (ssize_t)rp;
+	for (y = 0 ; y < height ; ++y) {
+		if (!lines[y].ok)
+			res = -1;
+	}
+	free(lines);
+	return res;
+}
+#undef PCX_PALETTE256_MARKER
+#undef PCX_PALETTE256_SIZE
+#undef RLE_ZOO_RETURN_ERR
+#endif
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,321 @@
+/*
+	Run-Length Encoder/Decoder (RLE), Apple PICT PackBits Variant
+	Copyright (c) 2022, Eddy L O Jansson. Licensed under The MIT License.
+
+	PICT pixmaps are compressed one scanline at a time using PackBits, with
+	each packed scanline prefixed by its length in bytes. For 16-bit pixels
+	(packType 3) the counts are in words rather than bytes, so that a REP
+	repeats a whole pixel.
+
+	pict16_compress/decompress implement the word mode on a flat stream.
+	The _image functions handle the per-row byte counts, for either pixel
+	size, and the decoder uses them to decode the rows in parallel.
+
+	See https://github.com/eloj/rle-zoo
+*/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stddef.h>
+#if defined(_MSC_VER)
+#include <BaseTsd.h>
+typedef SSIZE_T ssize_t;
+#else
+#include <sys/types.h> // ssize_t
+#endif
+
+ssize_t pict16_compress(const uint8_t *src, size_t slen, uint8_t *dest, size_t dlen);
+ssize_t pict16_decompress(const uint8_t *src, size_t slen, uint8_t *dest, size_t dlen);
+
+ssize_t pict_compress_image(const uint8_t *src, ptrdiff_t pitch, size_t rowbytes, size_t height, size_t psize, uint8_t *dest, size_t dlen);
+ssize_t pict_decompress_image(const uint8_t *src, size_t slen, uint8_t *dest, ptrdiff_t pitch, size_t rowbytes, size_t height, size_t psize);
+
+#if defined(RLE_ZOO_PICT_IMPLEMENTATION) || defined(RLE_ZOO_IMPLEMENTATION)
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+#include "rle_image.h"
+
+static_assert(sizeof(size_t) == sizeof(ssize_t), "");
+
+#if defined(_MSC_VER)
+#define RLE_ZOO_PICT_INLINE static __forceinline
+#else
+#define RLE_ZOO_PICT_INLINE static inline __attribute__((always_inline))
+#endif
+
+// return -(rp + 1) ... mask so it can't flip positive. Give up and just always return -1?
+#define RLE_ZOO_RETURN_ERR return ~(rp & ((size_t)~0 >> 1UL))
+
+// Rows shorter than this are stored unpacked, and without a byte count.
+#define PICT_MIN_PACKED_ROWBYTES 8
+// Rows longer than this have a two-byte byte count.
+#define PICT_MAX_SHORT_ROWBYTES 250
+
+// Fill `cnt` words at `dest` with copies of `unit`, eight bytes at a time.
+RLE_ZOO_PICT_INLINE void pict_fill(uint8_t *dest, const uint8_t *unit, size_t cnt, const size_t psize) {
+	if (psize == 1) {
+		memset(dest, unit[0], cnt);
+		return;
+	}
+	uint8_t pat[8];
+	for (size_t i = 0 ; i < sizeof(pat) ; i += psize)
+		memcpy(pat + i, unit, psize);
+
+	const size_t len = cnt * psize;
+	size_t i = 0;
+	for ( ; i + sizeof(pat) <= len ; i += sizeof(pat))
+		memcpy(dest + i, pat, sizeof(pat));
+	memcpy(dest + i, pat, len - i);
+}
+
+// RLE PARAMS: min CPY=1, max CPY=128, min REP=2, max REP=128 (in units of `psize` bytes)
+RLE_ZOO_PICT_INLINE ssize_t pict_compress_kernel(const uint8_t *src, size_t slen, uint8_t *dest, size_t dlen, const size_t psize) {
+	size_t rp = 0;
+	size_t wp = 0;
+
+	if (slen % psize != 0) {
+		RLE_ZOO_RETURN_ERR;
+	}
+
+	while (rp < slen) {
+		assert((ssize_t)wp >= 0);
+		assert((ssize_t)rp >= 0);
+
+		// Count number of same units, up to 128.
+		size_t cnt = 0;
+		do { ++cnt; } while ((rp + cnt * psize < slen) && (cnt < 128) && (memcmp(src + rp + (cnt - 1) * psize, src + rp + cnt * psize, psize) == 0));
+
+		// Output REP.
+		if (cnt > 1) {
+			assert(cnt >= 2 && cnt <= 128);
+			if (dest) {
+				if (wp + 1 + psize <= dlen) {
+					dest[wp] = (uint8_t)(257 - cnt);
+					memcpy(dest + wp + 1, src + rp, psize);
+				} else {
+					RLE_ZOO_RETURN_ERR;
+				}
+			}
+			wp += 1 + psize;
+			rp += cnt * psize;
+			continue;
+		}
+
+		// Count number of literal units, up to 128, stopping short of any pair.
+		cnt = 0;
+		while ((rp + (cnt + 1) * psize <= slen) && (cnt < 128) &&
+			((rp + (cnt + 1) * psize == slen) || (memcmp(src + rp + cnt * psize, src + rp + (cnt + 1) * psize, psize) != 0))) {
+			++cnt;
+		}
+
+		assert(cnt > 0);
+		assert(cnt <= 128);
+
+		// Output CPY
+		const size_t len = cnt * psize;
+		if (dest) {
+			if (wp + 1 + len <= dlen) {
+				dest[wp] = (uint8_t)(cnt - 1);
+				memcpy(dest + wp + 1, src + rp, len);
+			} else {
+				RLE_ZOO_RETURN_ERR;
+			}
+		}
+		rp += len;
+		wp += 1 + len;
+	}
+	assert(rp == slen);
+	assert((dest == NULL) || (wp <= dlen));
+	return (ssize_t)wp;
+}
+
+RLE_ZOO_PICT_INLINE ssize_t pict_decompress_kernel(const uint8_t *src, size_t slen, uint8_t *dest, size_t dlen, const size_t psize) {
+	size_t wp = 0;
+	size_t rp = 0;
+	while (rp < slen) {
+		assert((ssize_t)wp >= 0);
+		assert((ssize_t)rp >= 0);
+
+		size_t len = 0;
+		uint8_t b = src[rp++];
+		if (b > 0x80) {
+			// REP
+			size_t cnt = (size_t)(257 - b);
+			len = cnt * psize;
+			if (!(rp + psize <= slen)) {
+				RLE_ZOO_RETURN_ERR;
+			}
+			if (dest) {
+				if (wp + len <= dlen) {
+					pict_fill(dest + wp, src + rp, cnt, psize);
+				} else {
+					RLE_ZOO_RETURN_ERR;
+				}
+			}
+			rp += psize;
+		} else if (b < 0x80) {
+			// CPY
+			len = ((size_t)b + 1) * psize;
+			if (!(rp + len <= slen)) {
+				RLE_ZOO_RETURN_ERR;
+			}
+			if (dest) {
+				if (wp + len <= dlen) {
+					memcpy(dest + wp, src + rp, len);
+				} else {
+					RLE_ZOO_RETURN_ERR;
+				}
+			}
+			rp += len;
+		}
+		wp += len;
+	}
+	assert(rp == slen);
+	assert((dest == NULL) || (wp <= dlen));
+	return (ssize_t)wp;
+}
+
+ssize_t pict16_compress(const uint8_t *src, size_t slen, uint8_t *dest, size_t dlen) {
+	return pict_compress_kernel(src, slen, dest, dlen, 2);
+}
+
+ssize_t pict16_decompress(const uint8_t *src, size_t slen, uint8_t *dest, size_t dlen) {
+	return pict_decompress_kernel(src, slen, dest, dlen, 2);
+}
+
+// Each row is output as a byte count followed by the packed row, unless `rowbytes` is less
+// than eight, in which case rows are output as-is. `psize` is 1 for bytes, or 2 for words.
+ssize_t pict_compress_image(const uint8_t *src, ptrdiff_t pitch, size_t rowbytes, size_t height, size_t psize, uint8_t *dest, size_t dlen) {
+	if ((psize != 1 && psize != 2) || rowbytes % psize != 0)
+		return -1;
+
+	const size_t cntlen = rowbytes > PICT_MAX_SHORT_ROWBYTES ? 2 : 1;
+	size_t wp = 0;
+	for (size_t y = 0 ; y < height ; ++y) {
+		const uint8_t *row = src + (ptrdiff_t)y * pitch;
+		if (rowbytes < PICT_MIN_PACKED_ROWBYTES) {
+			if (dest) {
+				if (wp + rowbytes <= dlen) {
+					memcpy(dest + wp, row, rowbytes);
+				} else {
+					return -1;
+				}
+			}
+			wp += rowbytes;
+			continue;
+		}
+
+		uint8_t *out = dest ? dest + wp + cntlen : NULL;
+		size_t avail = (dest && wp + cntlen <= dlen) ? dlen - wp - cntlen : 0;
+		ssize_t res = (psize == 1) ? pict_compress_kernel(row, rowbytes, out, avail, 1) : pict_compress_kernel(row, rowbytes, out, avail, 2);
+		if (res < 0 || (size_t)res >> (8 * cntlen) != 0)
+			return -1;
+		if (dest) {
+			if (cntlen == 2)
+				dest[wp++] = (uint8_t)(res >> 8);
+			dest[wp++] = (uint8_t)res;
+		} else {
+			wp += cntlen;
+		}
+		wp += (size_t)res;
+	}
+	assert((dest == NULL) || (wp <= dlen));
+	return (ssize_t)wp;
+}
+
+struct pict_row {
+	size_t ofs;
+	size_t len;
+	ssize_t res;
+};
+
+struct pict_image_ctx {
+	const uint8_t *src;
+	struct pict_row *rows;
+	uint8_t *dest;
+	ptrdiff_t pitch;
+	size_t rowbytes;
+	size_t psize;
+};
+
+static void pict_decompress_rows(void *arg, size_t begin, size_t end) {
+	const struct pict_image_ctx *ctx = (const struct pict_image_ctx *)arg;
+	for (size_t y = begin ; y < end ; ++y) {
+		struct pict_row *row = &ctx->rows[y];
+		const uint8_t *in = ctx->src + row->ofs;
+		uint8_t *out = ctx->dest + (ptrdiff_t)y * ctx->pitch;
+		if (ctx->rowbytes < PICT_MIN_PACKED_ROWBYTES) {
+			memcpy(out, in, row->len);
+			row->res = (ssize_t)row->len;
+		} else if (ctx->psize == 1) {
+			row->res = pict_decompress_kernel(in, row->len, out, ctx->rowbytes, 1);
+		} else {
+			row->res = pict_decompress_kernel(in, row->len, out, ctx->rowbytes, 2);
+		}
+	}
+}
+
+// Decode `height` rows of `rowbytes` bytes each into rows `pitch` bytes apart.
+// The byte counts are read up front into a table of rows, and the rows are then decoded
+// in parallel bands. Returns the number of input bytes consumed, or -1 if the row table
+// can't be allocated. On decoding errors, the lowest failing row determines the result.
+ssize_t pict_decompress_image(const uint8_t *src, size_t slen, uint8_t *dest, ptrdiff_t pitch, size_t rowbytes, size_t height, size_t psize) {
+	if ((psize != 1 && psize != 2) || rowbytes % psize != 0)
+		return -1;
+	if (height == 0)
+		return 0;
+
+	struct pict_row *rows = (struct pict_row *)malloc(height * sizeof(*rows));
+	if (!rows)
+		return -1;
+
+	size_t rp = 0;
+	for (size_t y = 0 ; y < height ; ++y) {
+		size_t len = rowbytes;
+		if (rowbytes >= PICT_MIN_PACKED_ROWBYTES) {
+			size_t cntlen = rowbytes > PICT_MAX_SHORT_ROWBYTES ? 2 : 1;
+			if (!(rp + cntlen <= slen)) {
+				free(rows);
+				RLE_ZOO_RETURN_ERR;
+			}
+			len = src[rp++];
+			if (cntlen == 2)
+				len = (len << 8) | src[rp++];
+		}
+		if (!(rp + len <= slen)) {
+			free(rows);
+			RLE_ZOO_RETURN_ERR;
+		}
+		rows[y].ofs = rp;
+		rows[y].len = len;
+		rows[y].res = 0;
+		rp += len;
+	}
+
+	struct pict_image_ctx ctx = { src, rows, dest, pitch, rowbytes, psize };
+	// Bands of about 64KiB of output or more, so the threads have something to chew on.
+	rle_image_parallel_for(height, 1 + 65536 / (rowbytes + 1), pict_decompress_rows, &ctx);
+
+	for (size_t y = 0 ; y < height ; ++y) {
+		if (rows[y].res != (ssize_t)rowbytes) {
+			// Point at the failing op, or the end of a row that decoded short.
+			rp = rows[y].ofs + (rows[y].res < 0 ? ~(size_t)rows[y].res : rows[y].len);
+			free(rows);
+			RLE_ZOO_RETURN_ERR;
+		}
+	}
+	free(rows);
+	return (ssize_t)rp;
+}
+#undef PICT_MIN_PACKED_ROWBYTES
+#undef PICT_MAX_SHORT_ROWBYTES
+#undef RLE_ZOO_RETURN_ERR
+#undef RLE_ZOO_PICT_INLINE
+#endif
+
+#ifdef __cplusplus
+}
+#endif
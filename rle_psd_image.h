@@ -0,0 +1,260 @@
+/*
+	Adobe Photoshop PSD/PSB Image Data Loader
+	Copyright (c) 2022, Eddy L O Jansson. Licensed under The MIT License.
+
+	Parses the header of a PSD (or large document PSB) file, skips to the
+	merged image data at the end, and decodes it into interleaved RGBA or
+	CMYK pixels in a caller-supplied image with an arbitrary pitch.
+
+	The image data is stored one channel after the other. When compressed,
+	each row of each channel is packed on its own, and a table of the
+	packed size of every row comes first, so every row can be found up
+	front with a prefix sum. Bands of rows are then decoded in parallel,
+	each row of every channel by packbits_decompress() into a small buffer,
+	from which the channels are interleaved into the output.
+
+	Only 8-bit channels are supported. CMYK is output as stored, which is
+	inverted; zero is full ink.
+
+	See https://github.com/eloj/rle-zoo
+*/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stddef.h>
+#if defined(_MSC_VER)
+#include <BaseTsd.h>
+typedef SSIZE_T ssize_t;
+#else
+#include <sys/types.h> // ssize_t
+#endif
+#include "rle_packbits.h"
+
+#define PSD_HEADER_SIZE 26
+
+enum psd_format {
+	PSD_FORMAT_RGBA,	// Four bytes per pixel; RGB images. Opaque if there is no fourth channel.
+	PSD_FORMAT_CMYK,	// Four bytes per pixel; CMYK images.
+};
+
+enum psd_mode {
+	PSD_MODE_RGB = 3,
+	PSD_MODE_CMYK = 4,
+};
+
+struct psd_image {
+	unsigned int version;	// 1 for PSD, 2 for PSB.
+	unsigned int nchannels;
+	size_t width;
+	size_t height;
+	unsigned int depth;	// Bits per channel.
+	unsigned int mode;
+	unsigned int compression;	// 0 for raw, 1 for packbits.
+	size_t data_ofs;	// Offset in the file of the image data, after the compression field.
+};
+
+int psd_image_parse(const uint8_t *src, size_t slen, struct psd_image *img);
+size_t psd_image_rowlen(const struct psd_image *img, enum psd_format fmt);
+ssize_t psd_image_decode(const struct psd_image *img, const uint8_t *src, size_t slen, enum psd_format fmt, uint8_t *dest, ptrdiff_t pitch);
+
+#if defined(RLE_ZOO_PSD_IMAGE_IMPLEMENTATION) || defined(RLE_ZOO_IMPLEMENTATION)
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+#include "rle_image.h"
+
+static_assert(sizeof(size_t) == sizeof(ssize_t), "");
+
+// return -(rp + 1) ... mask so it can't flip positive. Give up and just always return -1?
+#define RLE_ZOO_RETURN_ERR return ~(rp & ((size_t)~0 >> 1UL))
+
+static inline size_t psd_be16(const uint8_t *p) {
+	return (size_t)p[0] << 8 | (size_t)p[1];
+}
+
+static inline size_t psd_be32(const uint8_t *p) {
+	return (size_t)p[0] << 24 | (size_t)p[1] << 16 | (size_t)p[2] << 8 | (size_t)p[3];
+}
+
+// Skip the section at `*rp` with a length field of `lensize` bytes. Returns 0 on success.
+static int psd_skip_section(const uint8_t *src, size_t slen, size_t *rp, size_t lensize) {
+	if (lensize > slen - *rp)
+		return -1;
+	size_t len = psd_be32(src + *rp + lensize - 4);
+	// Sections of PSB files over 4GiB are not supported.
+	if (lensize == 8 && psd_be32(src + *rp) != 0)
+		return -1;
+	*rp += lensize;
+	if (len > slen - *rp)
+		return -1;
+	*rp += len;
+	return 0;
+}
+
+// Returns 0 on success, or -1 if the input isn't a PSD file this loader understands.
+int psd_image_parse(const uint8_t *src, size_t slen, struct psd_image *img) {
+	if (slen < PSD_HEADER_SIZE || memcmp(src, "8BPS", 4) != 0)
+		return -1;
+
+	img->version = (unsigned int)psd_be16(src + 4);
+	img->nchannels = (unsigned int)psd_be16(src + 12);
+	img->height = psd_be32(src + 14);
+	img->width = psd_be32(src + 18);
+	img->depth = (unsigned int)psd_be16(src + 22);
+	img->mode = (unsigned int)psd_be16(src + 24);
+
+	if (img->version != 1 && img->version != 2)
+		return -1;
+	if (img->nchannels == 0 || img->depth != 8)
+		return -1;
+
+	// Skip the color mode data, image resources, and layer and mask information.
+	size_t rp = PSD_HEADER_SIZE;
+	if (psd_skip_section(src, slen, &rp, 4) != 0 || psd_skip_section(src, slen, &rp, 4) != 0 ||
+		psd_skip_section(src, slen, &rp, img->version == 2 ? 8 : 4) != 0)
+		return -1;
+
+	if (slen - rp < 2)
+		return -1;
+	img->compression = (unsigned int)psd_be16(src + rp);
+	img->data_ofs = rp + 2;
+	if (img->compression > 1)
+		return -1;
+
+	return 0;
+}
+
+// Returns the number of bytes in an output row, or 0 if the format isn't available for the image.
+size_t psd_image_rowlen(const struct psd_image *img, enum psd_format fmt) {
+	switch (fmt) {
+		case PSD_FORMAT_RGBA:
+			return (img->mode == PSD_MODE_RGB && img->nchannels >= 3) ? 4 * img->width : 0;
+		case PSD_FORMAT_CMYK:
+			return (img->mode == PSD_MODE_CMYK && img->nchannels >= 4) ? 4 * img->width : 0;
+	}
+	return 0;
+}
+
+struct psd_image_ctx {
+	const struct psd_image *img;
+	const uint8_t *src;
+	const size_t *rows;	// Offset of every row of every channel, plus one past the end, or NULL if raw.
+	unsigned int nout;	// Channels in the output.
+	uint8_t *dest;
+	ptrdiff_t pitch;
+	size_t *failed;	// Per row; the offset of a row that failed, plus one.
+};
+
+static void psd_decode_rows(void *arg, size_t begin, size_t end) {
+	const struct psd_image_ctx *ctx = (const struct psd_image_ctx *)arg;
+	const struct psd_image *img = ctx->img;
+	const size_t width = img->width;
+	const size_t height = img->height;
+
+	uint8_t *line = NULL;
+	if (ctx->rows) {
+		line = (uint8_t *)malloc(4 * width);
+		if (!line) {
+			for (size_t y = begin ; y < end ; ++y)
+				ctx->failed[y] = 1;
+			return;
+		}
+	}
+
+	for (size_t y = begin ; y < end ; ++y) {
+		const uint8_t *ch[4] = { NULL, NULL, NULL, NULL };
+		ctx->failed[y] = 0;
+		for (unsigned int c = 0 ; c < ctx->nout ; ++c) {
+			if (!ctx->rows) {
+				ch[c] = ctx->src + img->data_ofs + (c * height + y) * width;
+				continue;
+			}
+			const size_t r = c * height + y;
+			const size_t ofs = ctx->rows[r];
+			const size_t len = ctx->rows[r + 1] - ofs;
+			ssize_t res = packbits_decompress(ctx->src + ofs, len, line + c * width, width);
+			if (res != (ssize_t)width) {
+				ctx->failed[y] = (res < 0 ? ofs + (size_t)(-(res + 1)) : ofs) + 1;
+				break;
+			}
+			ch[c] = line + c * width;
+		}
+		if (ctx->failed[y])
+			continue;
+		rle_image_interleave4(ctx->dest + (ptrdiff_t)y * ctx->pitch, ch[0], ch[1], ch[2], ch[3], width);
+	}
+	free(line);
+}
+
+// Decode the image data of `src` (the whole file) into rows `pitch` bytes apart, each psd_image_rowlen() bytes long.
+// Returns the offset in `src` just past the image data, or an error as -(offset + 1) of the earliest row that failed,
+// or -1 if the format isn't available for the image or memory can't be allocated.
+ssize_t psd_image_decode(const struct psd_image *img, const uint8_t *src, size_t slen, enum psd_format fmt, uint8_t *dest, ptrdiff_t pitch) {
+	if (psd_image_rowlen(img, fmt) == 0 || img->data_ofs > slen)
+		return -1;
+
+	const size_t width = img->width;
+	const size_t height = img->height;
+	const size_t nrows = img->nchannels * height;
+	unsigned int nout = img->nchannels < 4 ? img->nchannels : 4;
+	size_t rp = img->data_ofs;
+	size_t *rows = NULL;
+
+	if (img->compression == 1) {
+		// Sum up the row byte counts, which are 16-bit in PSD files and 32-bit in PSB.
+		const size_t countsize = img->version == 2 ? 4 : 2;
+		if (nrows > (slen - rp) / countsize) {
+			rp = slen;
+			RLE_ZOO_RETURN_ERR;
+		}
+		rows = (size_t *)malloc((nrows + 1) * sizeof(*rows));
+		if (!rows)
+			return -1;
+		const uint8_t *counts = src + rp;
+		rp += nrows * countsize;
+		for (size_t r = 0 ; r < nrows ; ++r) {
+			size_t cnt = countsize == 4 ? psd_be32(counts + 4 * r) : psd_be16(counts + 2 * r);
+			rows[r] = rp;
+			if (cnt > slen - rp) {
+				free(rows);
+				RLE_ZOO_RETURN_ERR;
+			}
+			rp += cnt;
+		}
+		rows[nrows] = rp;
+	} else {
+		if (width != 0 && nrows > (slen - rp) / width) {
+			rp = slen;
+			RLE_ZOO_RETURN_ERR;
+		}
+		rp += nrows * width;
+	}
+
+	size_t *failed = (size_t *)malloc((height ? height : 1) * sizeof(*failed));
+	if (!failed) {
+		free(rows);
+		return -1;
+	}
+
+	struct psd_image_ctx ctx = { img, src, rows, nout, dest, pitch, failed };
+	rle_image_parallel_for(height, 1 + 65536 / (4 * width + 1), psd_decode_rows, &ctx);
+
+	ssize_t res = (ssize_t)rp;
+	for (size_t y = 0 ; y < height ; ++y) {
+		if (failed[y]) {
+			res = failed[y] == 1 ? -1 : -(ssize_t)failed[y];
+			break;
+		}
+	}
+	free(failed);
+	free(rows);
+	return res;
+}
+#undef RLE_ZOO_RETURN_ERR
+#endif
+
+#ifdef __cplusplus
+}
+#endif
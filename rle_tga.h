@@ -0,0 +1,296 @@
+/*
+	Run-Length Encoder/Decoder (RLE), Truevision TGA Variant
+	Copyright (c) 2022, Eddy L O Jansson. Licensed under The MIT License.
+
+	The TGA variant operates on pixels of one to four bytes, so there is one
+	pair of functions per pixel size, plus generic ones taking the pixel size
+	as an argument. All of them share the same kernel, specialized on a
+	constant pixel size by the compiler.
+
+	See https://github.com/eloj/rle-zoo
+*/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stddef.h>
+#if defined(_MSC_VER)
+#include <BaseTsd.h>
+typedef SSIZE_T ssize_t;
+#else
+#include <sys/types.h> // ssize_t
+#endif
+
+ssize_t tga8_compress(const uint8_t *src, size_t slen, uint8_t *dest, size_t dlen);
+ssize_t tga8_decompress(const uint8_t *src, size_t slen, uint8_t *dest, size_t dlen);
+ssize_t tga16_compress(const uint8_t *src, size_t slen, uint8_t *dest, size_t dlen);
+ssize_t tga16_decompress(const uint8_t *src, size_t slen, uint8_t *dest, size_t dlen);
+ssize_t tga24_compress(const uint8_t *src, size_t slen, uint8_t *dest, size_t dlen);
+ssize_t tga24_decompress(const uint8_t *src, size_t slen, uint8_t *dest, size_t dlen);
+ssize_t tga32_compress(const uint8_t *src, size_t slen, uint8_t *dest, size_t dlen);
+ssize_t tga32_decompress(const uint8_t *src, size_t slen, uint8_t *dest, size_t dlen);
+
+ssize_t tga_compress(const uint8_t *src, size_t slen, uint8_t *dest, size_t dlen, size_t psize);
+ssize_t tga_decompress(const uint8_t *src, size_t slen, uint8_t *dest, size_t dlen, size_t psize);
+ssize_t tga_decompress_image(const uint8_t *src, size_t slen, uint8_t *dest, ptrdiff_t pitch, size_t width, size_t height, size_t psize);
+
+#if defined(RLE_ZOO_TGA_IMPLEMENTATION) || defined(RLE_ZOO_IMPLEMENTATION)
+#include <assert.h>
+#include <string.h>
+
+static_assert(sizeof(size_t) == sizeof(ssize_t), "");
+
+#if defined(_MSC_VER)
+#define RLE_ZOO_TGA_INLINE static __forceinline
+#else
+#define RLE_ZOO_TGA_INLINE static inline __attribute__((always_inline))
+#endif
+
+// return -(rp + 1) ... mask so it can't flip positive. Give up and just always return -1?
+#define RLE_ZOO_RETURN_ERR return ~(rp & ((size_t)~0 >> 1UL))
+
+// Fill `cnt` pixels at `dest` with copies of `pixel`.
+RLE_ZOO_TGA_INLINE void tga_fill(uint8_t *dest, const uint8_t *pixel, size_t cnt, const size_t psize) {
+	if (psize == 1) {
+		memset(dest, pixel[0], cnt);
+		return;
+	}
+
+	// Replicate the pixel into a pattern that is a whole number of both pixels and 64-bit words,
+	// and store that. For RGB (24-bit) this is eight pixels in three words.
+	const size_t patlen = (psize == 3) ? 24 : 8;
+	uint8_t pat[24];
+	for (size_t i = 0 ; i < patlen ; i += psize)
+		memcpy(pat + i, pixel, psize);
+
+	const size_t len = cnt * psize;
+	size_t i = 0;
+	for ( ; i + patlen <= len ; i += patlen)
+		memcpy(dest + i, pat, patlen);
+	memcpy(dest + i, pat, len - i);
+}
+
+// RLE PARAMS: min CPY=1, max CPY=128, min REP=2, max REP=128 (in pixels)
+RLE_ZOO_TGA_INLINE ssize_t tga_compress_kernel(const uint8_t *src, size_t slen, uint8_t *dest, size_t dlen, const size_t psize) {
+	size_t rp = 0;
+	size_t wp = 0;
+
+	if (slen % psize != 0) {
+		RLE_ZOO_RETURN_ERR;
+	}
+
+	while (rp < slen) {
+		assert((ssize_t)wp >= 0);
+		assert((ssize_t)rp >= 0);
+
+		// Count number of same pixels, up to 128.
+		size_t cnt = 0;
+		do { ++cnt; } while ((rp + cnt * psize < slen) && (cnt < 128) && (memcmp(src + rp + (cnt - 1) * psize, src + rp + cnt * psize, psize) == 0));
+
+		// Output REP.
+		if (cnt > 1) {
+			assert(cnt >= 2 && cnt <= 128);
+			if (dest) {
+				if (wp + 1 + psize <= dlen) {
+					dest[wp] = (uint8_t)(0x80 | (cnt - 1));
+					memcpy(dest + wp + 1, src + rp, psize);
+				} else {
+					RLE_ZOO_RETURN_ERR;
+				}
+			}
+			wp += 1 + psize;
+			rp += cnt * psize;
+			continue;
+		}
+
+		// Count number of literal pixels, up to 128, stopping short of any pair.
+		cnt = 0;
+		while ((rp + (cnt + 1) * psize <= slen) && (cnt < 128) &&
+			((rp + (cnt + 1) * psize == slen) || (memcmp(src + rp + cnt * psize, src + rp + (cnt + 1) * psize, psize) != 0))) {
+			++cnt;
+		}
+
+		assert(cnt > 0);
+		assert(cnt <= 128);
+
+		// Output CPY
+		const size_t len = cnt * psize;
+		if (dest) {
+			if (wp + 1 + len <= dlen) {
+				dest[wp] = (uint8_t)(cnt - 1);
+				memcpy(dest + wp + 1, src + rp, len);
+			} else {
+				RLE_ZOO_RETURN_ERR;
+			}
+		}
+		rp += len;
+		wp += 1 + len;
+	}
+	assert(rp == slen);
+	assert((dest == NULL) || (wp <= dlen));
+	return (ssize_t)wp;
+}
+
+RLE_ZOO_TGA_INLINE ssize_t tga_decompress_kernel(const uint8_t *src, size_t slen, uint8_t *dest, size_t dlen, const size_t psize) {
+	size_t wp = 0;
+	size_t rp = 0;
+	while (rp < slen) {
+		assert((ssize_t)wp >= 0);
+		assert((ssize_t)rp >= 0);
+
+		uint8_t b = src[rp++];
+		size_t cnt = (size_t)(b & 0x7F) + 1;
+		size_t len = cnt * psize;
+		if (b & 0x80) {
+			// REP
+			if (!(rp + psize <= slen)) {
+				RLE_ZOO_RETURN_ERR;
+			}
+			if (dest) {
+				if (wp + len <= dlen) {
+					tga_fill(dest + wp, src + rp, cnt, psize);
+				} else {
+					RLE_ZOO_RETURN_ERR;
+				}
+			}
+			rp += psize;
+		} else {
+			// CPY
+			if (!(rp + len <= slen)) {
+				RLE_ZOO_RETURN_ERR;
+			}
+			if (dest) {
+				if (wp + len <= dlen) {
+					memcpy(dest + wp, src + rp, len);
+				} else {
+					RLE_ZOO_RETURN_ERR;
+				}
+			}
+			rp += len;
+		}
+		wp += len;
+	}
+	assert(rp == slen);
+	assert((dest == NULL) || (wp <= dlen));
+	return (ssize_t)wp;
+}
+
+// Decode `width` x `height` pixels into rows `pitch` bytes apart. Packets may span rows.
+// For bottom-left origin images, point `dest` at the last row and pass a negative pitch.
+// Returns the number of input bytes consumed, since image data is usually followed by more file.
+RLE_ZOO_TGA_INLINE ssize_t tga_decompress_image_kernel(const uint8_t *src, size_t slen, uint8_t *dest, ptrdiff_t pitch, size_t width, size_t height, const size_t psize) {
+	size_t rp = 0;
+	size_t x = 0;
+	size_t y = 0;
+	uint8_t *row = dest;
+
+	while (y < height) {
+		if (!(rp < slen)) {
+			RLE_ZOO_RETURN_ERR;
+		}
+		uint8_t b = src[rp++];
+		size_t cnt = (size_t)(b & 0x7F) + 1;
+		size_t plen = (b & 0x80) ? psize : cnt * psize;
+		if (!(rp + plen <= slen)) {
+			RLE_ZOO_RETURN_ERR;
+		}
+		const uint8_t *pixel = src + rp;
+		rp += plen;
+
+		while (cnt > 0) {
+			if (y == height) {
+				// Packet overruns the image.
+				RLE_ZOO_RETURN_ERR;
+			}
+			size_t n = width - x;
+			if (cnt < n)
+				n = cnt;
+			if (b & 0x80) {
+				tga_fill(row + x * psize, pixel, n, psize);
+			} else {
+				memcpy(row + x * psize, pixel, n * psize);
+				pixel += n * psize;
+			}
+			x += n;
+			cnt -= n;
+			if (x == width) {
+				x = 0;
+				if (++y < height)
+					row += pitch;
+			}
+		}
+	}
+	return (ssize_t)rp;
+}
+
+ssize_t tga8_compress(const uint8_t *src, size_t slen, uint8_t *dest, size_t dlen) {
+	return tga_compress_kernel(src, slen, dest, dlen, 1);
+}
+
+ssize_t tga8_decompress(const uint8_t *src, size_t slen, uint8_t *dest, size_t dlen) {
+	return tga_decompress_kernel(src, slen, dest, dlen, 1);
+}
+
+ssize_t tga16_compress(const uint8_t *src, size_t slen, uint8_t *dest, size_t dlen) {
+	return tga_compress_kernel(src, slen, dest, dlen, 2);
+}
+
+ssize_t tga16_decompress(const uint8_t *src, size_t slen, uint8_t *dest, size_t dlen) {
+	return tga_decompress_kernel(src, slen, dest, dlen, 2);
+}
+
+ssize_t tga24_compress(const uint8_t *src, size_t slen, uint8_t *dest, size_t dlen) {
+	return tga_compress_kernel(src, slen, dest, dlen, 3);
+}
+
+ssize_t tga24_decompress(const uint8_t *src, size_t slen, uint8_t *dest, size_t dlen) {
+	return tga_decompress_kernel(src, slen, dest, dlen, 3);
+}
+
+ssize_t tga32_compress(const uint8_t *src, size_t slen, uint8_t *dest, size_t dlen) {
+	return tga_compress_kernel(src, slen, dest, dlen, 4);
+}
+
+ssize_t tga32_decompress(const uint8_t *src, size_t slen, uint8_t *dest, size_t dlen) {
+	return tga_decompress_kernel(src, slen, dest, dlen, 4);
+}
+
+ssize_t tga_compress(const uint8_t *src, size_t slen, uint8_t *dest, size_t dlen, size_t psize) {
+	switch (psize) {
+		case 1: return tga8_compress(src, slen, dest, dlen);
+		case 2: return tga16_compress(src, slen, dest, dlen);
+		case 3: return tga24_compress(src, slen, dest, dlen);
+		case 4: return tga32_compress(src, slen, dest, dlen);
+	}
+	return -1;
+}
+
+ssize_t tga_decompress(const uint8_t *src, size_t slen, uint8_t *dest, size_t dlen, size_t psize) {
+	switch (psize) {
+		case 1: return tga8_decompress(src, slen, dest, dlen);
+		case 2: return tga16_decompress(src, slen, dest, dlen);
+		case 3: return tga24_decompress(src, slen, dest, dlen);
+		case 4: return tga32_decompress(src, slen, dest, dlen);
+	}
+	return -1;
+}
+
+ssize_t tga_decompress_image(const uint8_t *src, size_t slen, uint8_t *dest, ptrdiff_t pitch, size_t width, size_t height, size_t psize) {
+	if (width == 0 || height == 0)
+		return 0;
+	switch (psize) {
+		case 1: return tga_decompress_image_kernel(src, slen, dest, pitch, width, height, 1);
+		case 2: return tga_decompress_image_kernel(src, slen, dest, pitch, width, height, 2);
+		case 3: return tga_decompress_image_kernel(src, slen, dest, pitch, width, height, 3);
+		case 4: return tga_decompress_image_kernel(src, slen, dest, pitch, width, height, 4);
+	}
+	return -1;
+}
+#undef RLE_ZOO_RETURN_ERR
+#undef RLE_ZOO_TGA_INLINE
+#endif
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,376 @@
+/*
+	TIFF PackBits Image Loader
+	Copyright (c) 2022, Eddy L O Jansson. Licensed under The MIT License.
+
+	Parses the first image file directory (IFD) of a little- or big-endian
+	TIFF file, and decodes PackBits compressed (or uncompressed) strips or
+	tiles into a caller-supplied image with an arbitrary pitch.
+
+	The loader works on the complete file in memory, which is best mapped
+	rather than read for large files. The StripOffsets/StripByteCounts (or
+	TileOffsets/TileByteCounts) tables are read where they are in the file.
+
+	Every strip and tile is compressed independently, so they are all
+	decoded in parallel. When the pitch matches the row length, strips are
+	decoded by packbits_decompress() straight into their final position in
+	the output. Otherwise, and for tiles, each is decoded into a small
+	buffer and its rows are copied into place.
+
+	Only chunky (PlanarConfiguration 1) images are supported.
+
+	See https://github.com/eloj/rle-zoo
+*/
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stddef.h>
+#if defined(_MSC_VER)
+#include <BaseTsd.h>
+typedef SSIZE_T ssize_t;
+#else
+#include <sys/types.h> // ssize_t
+#endif
+#include "rle_packbits.h"
+
+#define TIFF_COMPRESSION_NONE 1
+#define TIFF_COMPRESSION_PACKBITS 32773
+
+struct tiff_image {
+	int big_endian;
+	size_t width;
+	size_t height;
+	unsigned int bits_per_sample;
+	unsigned int samples_per_pixel;
+	unsigned int compression;
+	unsigned int photometric;
+	size_t rows_per_strip;	// Rows in every strip, or tile_length for tiled images.
+	size_t tile_width;	// Zero if the image is stored in strips.
+	size_t tile_length;
+	size_t chunk_rowlen;	// Bytes in a row of a strip or tile.
+	size_t chunk_size;	// Decoded bytes in a full strip or tile.
+	size_t nchunks;	// Number of strips or tiles.
+	const uint8_t *offsets;	// `nchunks` offsets of type `offsets_type`, in the file.
+	const uint8_t *byte_counts;	// `nchunks` byte counts of type `byte_counts_type`, in the file.
+	unsigned int offsets_type;
+	unsigned int byte_counts_type;
+};
+
+int tiff_image_parse(const uint8_t *src, size_t slen, struct tiff_image *img);
+size_t tiff_image_rowlen(const struct tiff_image *img);
+ssize_t tiff_image_decode(const struct tiff_image *img, const uint8_t *src, size_t slen, uint8_t *dest, ptrdiff_t pitch);
+
+#if defined(RLE_ZOO_TIFF_IMAGE_IMPLEMENTATION) || defined(RLE_ZOO_IMPLEMENTATION)
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+#include "rle_image.h"
+
+static_assert(sizeof(size_t) == sizeof(ssize_t), "");
+
+// Tiles are decoded into a buffer of this size at most, per thread.
+#define TIFF_MAX_TILE_SIZE (64*1024*1024)
+// Tiles may overhang the image, since writers tend to use a fixed tile size, but not by more than this.
+#define TIFF_MAX_TILE_OVERHANG 1024
+
+enum tiff_tag {
+	TIFF_TAG_IMAGE_WIDTH = 256,
+	TIFF_TAG_IMAGE_LENGTH = 257,
+	TIFF_TAG_BITS_PER_SAMPLE = 258,
+	TIFF_TAG_COMPRESSION = 259,
+	TIFF_TAG_PHOTOMETRIC = 262,
+	TIFF_TAG_STRIP_OFFSETS = 273,
+	TIFF_TAG_SAMPLES_PER_PIXEL = 277,
+	TIFF_TAG_ROWS_PER_STRIP = 278,
+	TIFF_TAG_STRIP_BYTE_COUNTS = 279,
+	TIFF_TAG_PLANAR_CONFIGURATION = 284,
+	TIFF_TAG_TILE_WIDTH = 322,
+	TIFF_TAG_TILE_LENGTH = 323,
+	TIFF_TAG_TILE_OFFSETS = 324,
+	TIFF_TAG_TILE_BYTE_COUNTS = 325,
+};
+
+enum tiff_type {
+	TIFF_TYPE_BYTE = 1,
+	TIFF_TYPE_SHORT = 3,
+	TIFF_TYPE_LONG = 4,
+};
+
+static inline size_t tiff_u16(int be, const uint8_t *p) {
+	return be ? (size_t)p[0] << 8 | (size_t)p[1] : (size_t)p[1] << 8 | (size_t)p[0];
+}
+
+static inline size_t tiff_u32(int be, const uint8_t *p) {
+	return be ? (size_t)p[0] << 24 | (size_t)p[1] << 16 | (size_t)p[2] << 8 | (size_t)p[3]
+		: (size_t)p[3] << 24 | (size_t)p[2] << 16 | (size_t)p[1] << 8 | (size_t)p[0];
+}
+
+static inline size_t tiff_type_size(unsigned int type) {
+	switch (type) {
+		case TIFF_TYPE_BYTE: return 1;
+		case TIFF_TYPE_SHORT: return 2;
+		case TIFF_TYPE_LONG: return 4;
+	}
+	return 0;
+}
+
+// Returns element `i` of an array of integers of `type`.
+static inline size_t tiff_array_get(int be, const uint8_t *p, unsigned int type, size_t i) {
+	switch (type) {
+		case TIFF_TYPE_BYTE: return p[i];
+		case TIFF_TYPE_SHORT: return tiff_u16(be, p + 2 * i);
+		case TIFF_TYPE_LONG: return tiff_u32(be, p + 4 * i);
+	}
+	return 0;
+}
+
+// Returns 0 on success, or -1 if the input isn't a TIFF file this loader understands.
+int tiff_image_parse(const uint8_t *src, size_t slen, struct tiff_image *img) {
+	if (slen < 8)
+		return -1;
+	int be;
+	if (src[0] == 'I' && src[1] == 'I')
+		be = 0;
+	else if (src[0] == 'M' && src[1] == 'M')
+		be = 1;
+	else
+		return -1;
+	if (tiff_u16(be, src + 2) != 42)
+		return -1;
+
+	size_t ifd = tiff_u32(be, src + 4);
+	if (ifd > slen - 2)
+		return -1;
+	size_t nentries = tiff_u16(be, src + ifd);
+	if (nentries > (slen - ifd - 2) / 12)
+		return -1;
+
+	memset(img, 0, sizeof(*img));
+	img->big_endian = be;
+	img->bits_per_sample = 1;
+	img->samples_per_pixel = 1;
+	img->compression = TIFF_COMPRESSION_NONE;
+	img->rows_per_strip = (size_t)~0;
+	unsigned int planar = 1;
+	size_t noffsets = 0;
+	size_t nbyte_counts = 0;
+
+	for (size_t i = 0 ; i < nentries ; ++i) {
+		const uint8_t *entry = src + ifd + 2 + 12 * i;
+		size_t tag = tiff_u16(be, entry);
+		unsigned int type = (unsigned int)tiff_u16(be, entry + 2);
+		size_t count = tiff_u32(be, entry + 4);
+		size_t size = tiff_type_size(type);
+		if (size == 0 || count == 0)
+			continue;
+		// Values that fit are stored in the entry itself, others at an offset.
+		const uint8_t *data = entry + 8;
+		if (count > 4 / size) {
+			size_t ofs = tiff_u32(be, entry + 8);
+			if (count > slen / size || ofs > slen - count * size)
+				return -1;
+			data = src + ofs;
+		}
+		size_t value = tiff_array_get(be, data, type, 0);
+
+		switch (tag) {
+			case TIFF_TAG_IMAGE_WIDTH: img->width = value; break;
+			case TIFF_TAG_IMAGE_LENGTH: img->height = value; break;
+			case TIFF_TAG_BITS_PER_SAMPLE: img->bits_per_sample = (unsigned int)value; break;
+			case TIFF_TAG_COMPRESSION: img->compression = (unsigned int)value; break;
+			case TIFF_TAG_PHOTOMETRIC: img->photometric = (unsigned int)value; break;
+			case TIFF_TAG_SAMPLES_PER_PIXEL: img->samples_per_pixel = (unsigned int)value; break;
+			case TIFF_TAG_ROWS_PER_STRIP: img->rows_per_strip = value; break;
+			case TIFF_TAG_PLANAR_CONFIGURATION: planar = (unsigned int)value; break;
+			case TIFF_TAG_TILE_WIDTH: img->tile_width = value; break;
+			case TIFF_TAG_TILE_LENGTH: img->tile_length = value; break;
+			case TIFF_TAG_STRIP_OFFSETS:
+			case TIFF_TAG_TILE_OFFSETS:
+				img->offsets = data;
+				img->offsets_type = type;
+				noffsets = count;
+				break;
+			case TIFF_TAG_STRIP_BYTE_COUNTS:
+			case TIFF_TAG_TILE_BYTE_COUNTS:
+				img->byte_counts = data;
+				img->byte_counts_type = type;
+				nbyte_counts = count;
+				break;
+		}
+	}
+
+	if (img->width == 0 || img->height == 0 || !img->offsets || !img->byte_counts || planar != 1)
+		return -1;
+	if (img->compression != TIFF_COMPRESSION_NONE && img->compression != TIFF_COMPRESSION_PACKBITS)
+		return -1;
+	if (img->samples_per_pixel == 0 || img->samples_per_pixel > 16)
+		return -1;
+	switch (img->bits_per_sample) {
+		case 1: case 2: case 4: case 8: case 16:
+			break;
+		default:
+			return -1;
+	}
+
+	// The whole image must be addressable.
+	const size_t bits = (size_t)img->bits_per_sample * img->samples_per_pixel;
+	if (img->width > (SIZE_MAX - 7) / bits || img->height > SIZE_MAX / tiff_image_rowlen(img))
+		return -1;
+
+	if (img->tile_width || img->tile_length) {
+		// Tiles must be whole bytes wide, and by the spec a multiple of 16 in both directions.
+		if (img->tile_width == 0 || img->tile_length == 0 || bits % 8 != 0 ||
+			img->tile_width % 16 != 0 || img->tile_length % 16 != 0)
+			return -1;
+		if (img->tile_width > img->width + TIFF_MAX_TILE_OVERHANG || img->tile_length > img->height + TIFF_MAX_TILE_OVERHANG)
+			return -1;
+		if (img->tile_width > TIFF_MAX_TILE_SIZE / (bits / 8))
+			return -1;
+		img->chunk_rowlen = img->tile_width * (bits / 8);
+		if (img->tile_length > TIFF_MAX_TILE_SIZE / img->chunk_rowlen)
+			return -1;
+		img->chunk_size = img->chunk_rowlen * img->tile_length;
+		size_t across = (img->width + img->tile_width - 1) / img->tile_width;
+		size_t down = (img->height + img->tile_length - 1) / img->tile_length;
+		// Every tile needs an offset in the file, so more tiles than bytes is nonsense.
+		if (across > slen / down)
+			return -1;
+		img->rows_per_strip = img->tile_length;
+		img->nchunks = across * down;
+	} else {
+		if (img->rows_per_strip == 0)
+			return -1;
+		if (img->rows_per_strip > img->height)
+			img->rows_per_strip = img->height;
+		// Bounded by the size of the image, checked above.
+		img->chunk_rowlen = tiff_image_rowlen(img);
+		img->chunk_size = img->rows_per_strip * img->chunk_rowlen;
+		img->nchunks = (img->height + img->rows_per_strip - 1) / img->rows_per_strip;
+	}
+	if (noffsets < img->nchunks || nbyte_counts < img->nchunks)
+		return -1;
+	// Nothing can start inside the header. This also means no strip or tile fails at offset zero,
+	// so the error of one is never -1, which tiff_image_decode() returns when out of memory.
+	for (size_t i = 0 ; i < img->nchunks ; ++i) {
+		if (tiff_array_get(be, img->offsets, img->offsets_type, i) < 8)
+			return -1;
+	}
+
+	return 0;
+}
+
+// Returns the number of bytes in an output row.
+size_t tiff_image_rowlen(const struct tiff_image *img) {
+	return (img->width * img->bits_per_sample * img->samples_per_pixel + 7) / 8;
+}
+
+struct tiff_image_ctx {
+	const struct tiff_image *img;
+	const uint8_t *src;
+	size_t slen;
+	uint8_t *dest;
+	ptrdiff_t pitch;
+	ssize_t *results;	// Per strip or tile; zero, or the error. Left at -1 if out of memory.
+};
+
+// Decode strip or tile `i` into `out`, and return zero, or the offset in the file where decoding failed plus one.
+static size_t tiff_decode_chunk(const struct tiff_image_ctx *ctx, size_t i, uint8_t *out, size_t len) {
+	const struct tiff_image *img = ctx->img;
+	size_t ofs = tiff_array_get(img->big_endian, img->offsets, img->offsets_type, i);
+	size_t cnt = tiff_array_get(img->big_endian, img->byte_counts, img->byte_counts_type, i);
+	if (ofs > ctx->slen)
+		return ctx->slen + 1;
+	if (cnt > ctx->slen - ofs)
+		cnt = ctx->slen - ofs;
+
+	if (img->compression == TIFF_COMPRESSION_NONE) {
+		if (cnt < len)
+			return ofs + cnt + 1;
+		memcpy(out, ctx->src + ofs, len);
+		return 0;
+	}
+	ssize_t res = packbits_decompress(ctx->src + ofs, cnt, out, len);
+	if (res < 0)
+		return ofs + (size_t)(-(res + 1)) + 1;
+	if ((size_t)res != len)
+		return ofs + cnt + 1;
+	return 0;
+}
+
+static void tiff_decode_chunks(void *arg, size_t begin, size_t end) {
+	const struct tiff_image_ctx *ctx = (const struct tiff_image_ctx *)arg;
+	const struct tiff_image *img = ctx->img;
+	const int tiled = img->tile_width != 0;
+	const size_t rowlen = tiff_image_rowlen(img);
+
+	uint8_t *buf = NULL;
+	if (tiled || ctx->pitch != (ptrdiff_t)rowlen) {
+		buf = (uint8_t *)malloc(img->chunk_size);
+		if (!buf) {
+			for (size_t i = begin ; i < end ; ++i)
+				ctx->results[i] = -1;
+			return;
+		}
+	}
+
+	for (size_t i = begin ; i < end ; ++i) {
+		size_t x = 0;
+		size_t y = i * img->rows_per_strip;
+		if (tiled) {
+			size_t across = (img->width + img->tile_width - 1) / img->tile_width;
+			x = (i % across) * img->chunk_rowlen;
+			y = (i / across) * img->tile_length;
+		}
+		size_t rows = img->height - y < img->rows_per_strip ? img->height - y : img->rows_per_strip;
+		uint8_t *out = ctx->dest + (ptrdiff_t)y * ctx->pitch + x;
+
+		// Tiles are always full size, even at the edges of the image.
+		size_t len = tiled ? img->chunk_size : rows * img->chunk_rowlen;
+		size_t err = tiff_decode_chunk(ctx, i, buf ? buf : out, len);
+		if (err) {
+			ctx->results[i] = -(ssize_t)err;
+			continue;
+		}
+		if (buf) {
+			size_t cols = rowlen - x < img->chunk_rowlen ? rowlen - x : img->chunk_rowlen;
+			for (size_t r = 0 ; r < rows ; ++r)
+				memcpy(out + (ptrdiff_t)r * ctx->pitch, buf + r * img->chunk_rowlen, cols);
+		}
+		ctx->results[i] = 0;
+	}
+	free(buf);
+}
+
+// Decode the strips or tiles of `src` (the whole file) into rows `pitch` bytes apart, each tiff_image_rowlen() bytes long.
+// Returns the number of strips or tiles decoded, or an error as -(offset in `src` + 1) for the first one that
+// failed, or -1 if memory can't be allocated. Strips and tiles start past the header, so their errors are never -1.
+ssize_t tiff_image_decode(const struct tiff_image *img, const uint8_t *src, size_t slen, uint8_t *dest, ptrdiff_t pitch) {
+	const size_t n = img->nchunks;
+
+	ssize_t *results = (ssize_t *)malloc(n * sizeof(*results));
+	if (!results)
+		return -1;
+	for (size_t i = 0 ; i < n ; ++i)
+		results[i] = -1;
+
+	struct tiff_image_ctx ctx = { img, src, slen, dest, pitch, results };
+	rle_image_parallel_for(n, 1 + 65536 / (img->chunk_size + 1), tiff_decode_chunks, &ctx);
+
+	ssize_t res = (ssize_t)n;
+	for (size_t i = 0 ; i < n ; ++i) {
+		if (results[i] < 0) {
+			res = results[i];
+			break;
+		}
+	}
+	free(results);
+	return res;
+}
+#undef TIFF_MAX_TILE_SIZE
+#undef TIFF_MAX_TILE_OVERHANG
+#endif
+
+#ifdef __cplusplus
+}
+#endif
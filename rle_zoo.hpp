@@ -0,0 +1,593 @@
+/*
+	Run-Length Encoder/Decoder (RLE), C++ Variant Traits and Codecs
+	Copyright (c) 2022, Eddy L O Jansson. Licensed under The MIT License.
+
+	The table-described variants as compile-time traits, with codecs templated
+	on them, so that every variant is specialized and inlined at the call site
+	instead of being called through a function pointer.
+
+	A variant is described the same way as by its spec file, as the ranges of
+	op bytes of each op, and the policy of its encoder. From these, the decode
+	table and the encode tables of the variant are built as constexpr arrays.
+
+	compress<V>() and decompress<V>() take spans, and return the same values
+	as the C functions of the variant, including errors. A destination span
+	without data, such as `{}`, returns the size needed, like NULL does for
+	the C functions.
+
+	decoded_view<V> is a forward range over the decoded bytes of a stream,
+	which are decoded only as they're iterated over, for searching through
+	compressed data without decompressing it first.
+
+	coder<V> keeps an output buffer from a std::pmr::memory_resource across
+	calls, so that coding in a loop does no allocation once it's grown.
+
+	Requires C++20.
+
+	See https://github.com/eloj/rle-zoo
+*/
+#ifndef RLE_ZOO_HPP
+#define RLE_ZOO_HPP
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <memory_resource>
+#include <new>
+#include <ranges>
+#include <span>
+#if defined(_MSC_VER)
+#include <BaseTsd.h>
+typedef SSIZE_T ssize_t;
+#else
+#include <sys/types.h> // ssize_t
+#endif
+
+namespace rle_zoo {
+
+static_assert(sizeof(size_t) == sizeof(ssize_t), "");
+
+// The order and value of these match enum RLE_OP of rle-parse.h.
+enum class op : uint8_t {
+	cpy,
+	rep,
+	lit,
+	nop,
+	invalid,
+};
+
+// A range of op bytes, where byte `lo` has the count `count`, changing by `step` per byte up to `hi`.
+// The count of a LIT is ignored, since the op byte is its output.
+struct op_range {
+	op kind;
+	uint8_t lo;
+	uint8_t hi;
+	int count;
+	int step;
+};
+
+struct decoded_op {
+	op kind;
+	unsigned int cnt;	// The output count of CPY and REP ops.
+};
+
+struct encode_policy {
+	unsigned int min_rep;	// Runs at least this long are encoded as a REP.
+	bool rep_last;	// The last run is always encoded as a REP.
+	bool cpy_last;	// A CPY may take the last byte.
+	bool cpy_lookback;	// A CPY ends after `min_rep` same bytes, which are given back, rather than before any two.
+};
+
+template <class V>
+concept rle8_variant = requires {
+	{ V::name } -> std::convertible_to<const char *>;
+	V::ranges.size();
+	{ V::policy } -> std::convertible_to<encode_policy>;
+};
+
+struct goldbox {
+	static constexpr const char *name = "goldbox";
+	static constexpr std::array<op_range, 2> ranges = {{
+		{ op::cpy, 0x00, 0x7D, 1, 1 },
+		{ op::rep, 0x81, 0xFF, 127, -1 },
+	}};
+	static constexpr encode_policy policy = { 2, true, false, false };
+};
+
+struct packbits {
+	static constexpr const char *name = "packbits";
+	static constexpr std::array<op_range, 3> ranges = {{
+		{ op::cpy, 0x00, 0x7F, 1, 1 },
+		{ op::nop, 0x80, 0x80, 1, 0 },
+		{ op::rep, 0x81, 0xFF, 128, -1 },
+	}};
+	static constexpr encode_policy policy = { 2, false, true, false };
+};
+
+struct pcx {
+	static constexpr const char *name = "pcx";
+	static constexpr std::array<op_range, 2> ranges = {{
+		{ op::lit, 0x00, 0xBF, 0, 0 },
+		{ op::rep, 0xC0, 0xFF, 0, 1 },
+	}};
+	static constexpr encode_policy policy = { 2, false, false, false };
+};
+
+struct icns {
+	static constexpr const char *name = "icns";
+	static constexpr std::array<op_range, 2> ranges = {{
+		{ op::cpy, 0x00, 0x7F, 1, 1 },
+		{ op::rep, 0x80, 0xFF, 3, 1 },
+	}};
+	static constexpr encode_policy policy = { 3, false, true, true };
+};
+
+namespace detail {
+
+// Decode op byte `b` by the ranges of the variant, from range `I` on.
+template <rle8_variant V, size_t I = 0>
+constexpr decoded_op decode_op(uint8_t b) noexcept {
+	if constexpr (I == V::ranges.size()) {
+		return { op::invalid, 0 };
+	} else {
+		constexpr op_range r = V::ranges[I];
+		if (b >= r.lo && b <= r.hi) {
+			if constexpr (r.kind == op::cpy || r.kind == op::rep)
+				return { r.kind, (unsigned int)(r.count + r.step * (b - r.lo)) };
+			return { r.kind, 0 };
+		}
+		return decode_op<V, I + 1>(b);
+	}
+}
+
+template <rle8_variant V>
+constexpr std::array<decoded_op, 256> make_decode_table() noexcept {
+	std::array<decoded_op, 256> tbl {};
+	for (size_t b = 0 ; b < 256 ; ++b)
+		tbl[b] = decode_op<V>((uint8_t)b);
+	return tbl;
+}
+
+} // namespace detail
+
+// The decode table of the variant, as generated by rle-genops.
+template <rle8_variant V>
+inline constexpr std::array<decoded_op, 256> decode_table = detail::make_decode_table<V>();
+
+// The op byte which encodes a count, by count, or -1 where there is none.
+template <rle8_variant V, op Kind>
+inline constexpr std::array<int16_t, 256> encode_table = [] {
+	std::array<int16_t, 256> tbl {};
+	tbl.fill(-1);
+	for (size_t b = 0 ; b < 256 ; ++b) {
+		const decoded_op d = decode_table<V>[b];
+		if (d.kind == Kind && d.cnt < 256 && tbl[d.cnt] < 0)
+			tbl[d.cnt] = (int16_t)b;
+	}
+	return tbl;
+}();
+
+// The smallest and largest count of an op of the variant, or zero if it has none.
+template <rle8_variant V, op Kind>
+inline constexpr unsigned int min_count = [] {
+	unsigned int res = 0;
+	for (const decoded_op &d : decode_table<V>) {
+		if (d.kind == Kind && (res == 0 || d.cnt < res))
+			res = d.cnt;
+	}
+	return res;
+}();
+
+template <rle8_variant V, op Kind>
+inline constexpr unsigned int max_count = [] {
+	unsigned int res = 0;
+	for (const decoded_op &d : decode_table<V>) {
+		if (d.kind == Kind && d.cnt > res)
+			res = d.cnt;
+	}
+	return res;
+}();
+
+// return -(rp + 1) ... mask so it can't flip positive.
+#define RLE_ZOO_RETURN_ERR return ~(ssize_t)(rp & ((size_t)~0 >> 1UL))
+
+namespace detail {
+
+// The op the encoder uses for the input at `rp`, and the number of input bytes it takes in `cnt`.
+// Never looks further ahead than lookahead<V> bytes, or to the end of the input.
+template <rle8_variant V>
+inline op encode_op(const uint8_t *src, size_t slen, size_t rp, size_t &cnt) noexcept {
+	constexpr encode_policy pol = V::policy;
+	constexpr unsigned int max_rep = max_count<V, op::rep>;
+	constexpr unsigned int max_cpy = max_count<V, op::cpy>;
+	static_assert(max_rep > 0, "Variant has no REP op");
+
+	cnt = 1;
+	while (rp + cnt < slen && cnt < max_rep && src[rp + cnt] == src[rp]) {
+		++cnt;
+	}
+
+	bool rep = cnt >= pol.min_rep;
+	if constexpr (pol.rep_last)
+		rep = rep || rp + cnt == slen;
+	if constexpr (max_cpy == 0)
+		rep = rep || decode_table<V>[src[rp]].kind != op::lit;
+	if (rep)
+		return op::rep;
+
+	if constexpr (max_cpy == 0) {
+		return op::lit;
+	} else {
+		if constexpr (pol.cpy_lookback) {
+			size_t same = 0;
+			cnt = 1;
+			while (rp + cnt < slen && cnt < max_cpy) {
+				if (src[rp + cnt - 1] != src[rp + cnt]) {
+					same = 0;
+				} else if (++same == pol.min_rep - 1) {
+					cnt -= pol.min_rep - 1;
+					break;
+				}
+				++cnt;
+			}
+		} else {
+			cnt = 0;
+			while (rp + cnt + 1 < slen && cnt < max_cpy && src[rp + cnt] != src[rp + cnt + 1]) {
+				++cnt;
+			}
+			if constexpr (pol.cpy_last) {
+				if (rp + cnt + 1 == slen && cnt < max_cpy) {
+					++cnt;
+				}
+			}
+		}
+		assert(cnt > 0 && rp + cnt <= slen);
+		return op::cpy;
+	}
+}
+
+} // namespace detail
+
+// The most input encode_op() looks at, past which the end of the input makes no difference.
+template <rle8_variant V>
+inline constexpr size_t lookahead = (max_count<V, op::rep> > max_count<V, op::cpy> ? max_count<V, op::rep> : max_count<V, op::cpy>) + 2;
+
+// The most compress<V>() outputs for `n` bytes of input. Every op takes at least one byte,
+// and outputs at most two per byte it takes; a LIT variant codes a byte that isn't a LIT as a REP of one.
+template <rle8_variant V>
+constexpr size_t compress_bound(size_t n) noexcept {
+	return 2 * n;
+}
+
+template <rle8_variant V>
+ssize_t compress(std::span<const uint8_t> in, std::span<uint8_t> out) noexcept {
+	const uint8_t *src = in.data();
+	const size_t slen = in.size();
+	uint8_t *dest = out.data();
+	const size_t dlen = out.size();
+	size_t rp = 0;
+	size_t wp = 0;
+
+	while (rp < slen) {
+		size_t cnt;
+		const op kind = detail::encode_op<V>(src, slen, rp, cnt);
+		const size_t size = kind == op::cpy ? cnt + 1 : kind == op::rep ? 2 : 1;
+		if (dest) {
+			if (size > dlen - wp) {
+				RLE_ZOO_RETURN_ERR;
+			}
+			if (kind == op::lit) {
+				dest[wp] = src[rp];
+			} else if (kind == op::rep) {
+				dest[wp + 0] = (uint8_t)encode_table<V, op::rep>[cnt];
+				dest[wp + 1] = src[rp];
+			} else {
+				dest[wp] = (uint8_t)encode_table<V, op::cpy>[cnt];
+				memcpy(dest + wp + 1, src + rp, cnt);
+			}
+		}
+		wp += size;
+		rp += cnt;
+	}
+	assert(rp == slen);
+	assert((dest == nullptr) || (wp <= dlen));
+	return (ssize_t)wp;
+}
+
+template <rle8_variant V>
+ssize_t decompress(std::span<const uint8_t> in, std::span<uint8_t> out) noexcept {
+	const uint8_t *src = in.data();
+	const size_t slen = in.size();
+	uint8_t *dest = out.data();
+	const size_t dlen = out.size();
+	size_t rp = 0;
+	size_t wp = 0;
+
+	while (rp < slen) {
+		size_t cnt;
+		const uint8_t b = src[rp++];
+		// Decoding by the ranges, rather than the table, inlines the count of each op as arithmetic.
+		const decoded_op d = detail::decode_op<V>(b);
+		switch (d.kind) {
+			case op::cpy:
+				cnt = d.cnt;
+				if (cnt > slen - rp) {
+					RLE_ZOO_RETURN_ERR;
+				}
+				if (dest) {
+					if (cnt > dlen - wp) {
+						RLE_ZOO_RETURN_ERR;
+					}
+					memcpy(dest + wp, src + rp, cnt);
+				}
+				rp += cnt;
+				break;
+			case op::rep:
+				cnt = d.cnt;
+				if (!(rp < slen)) {
+					RLE_ZOO_RETURN_ERR;
+				}
+				if (dest) {
+					if (cnt > dlen - wp) {
+						RLE_ZOO_RETURN_ERR;
+					}
+					memset(dest + wp, src[rp], cnt);
+				}
+				++rp;
+				break;
+			case op::lit:
+				cnt = 1;
+				if (dest) {
+					if (!(wp < dlen)) {
+						RLE_ZOO_RETURN_ERR;
+					}
+					dest[wp] = b;
+				}
+				break;
+			case op::nop:
+				cnt = 0;
+				break;
+			case op::invalid:
+			default:
+				RLE_ZOO_RETURN_ERR;
+		}
+		wp += cnt;
+	}
+	assert(rp == slen);
+	assert((dest == nullptr) || (wp <= dlen));
+	return (ssize_t)wp;
+}
+#undef RLE_ZOO_RETURN_ERR
+
+// The decoded bytes of a compressed stream as a forward range, decoded as they're iterated over.
+//
+// An iterator holds only the op it's in; what's left of it, and where its bytes are in the
+// input, which is the same byte over and over for a REP. Nothing is ever expanded, so std
+// algorithms run over the compressed data as is. Adding to an iterator skips whole ops.
+//
+// Iteration stops at the end of the input, or at the first op that isn't valid or is cut
+// short, in which case error() of the iterator returns the error decompress<V>() would.
+template <rle8_variant V>
+class decoded_view : public std::ranges::view_interface<decoded_view<V>> {
+public:
+	class iterator {
+	public:
+		using iterator_concept = std::forward_iterator_tag;
+		using iterator_category = std::forward_iterator_tag;
+		using value_type = uint8_t;
+		using difference_type = ptrdiff_t;
+
+		iterator() = default;
+		explicit iterator(std::span<const uint8_t> in) noexcept : src(in.data()), slen(in.size()) {
+			next_op();
+		}
+
+		const uint8_t &operator*() const noexcept {
+			assert(left > 0);
+			return src[ip];
+		}
+
+		iterator &operator++() noexcept {
+			assert(left > 0);
+			++wp;
+			if (--left > 0) {
+				ip += !rep;
+			} else {
+				next_op();
+			}
+			return *this;
+		}
+
+		iterator operator++(int) noexcept {
+			iterator tmp = *this;
+			++*this;
+			return tmp;
+		}
+
+		// Skip `n` bytes, or up to the end. Ops skipped whole are decoded, but not expanded.
+		iterator &operator+=(difference_type n) noexcept {
+			assert(n >= 0);
+			size_t skip = (size_t)n;
+			while (left > 0 && skip >= left) {
+				skip -= left;
+				wp += left;
+				left = 0;
+				next_op();
+			}
+			if (left > 0) {
+				left -= skip;
+				wp += skip;
+				ip += rep ? 0 : skip;
+			}
+			return *this;
+		}
+
+		friend iterator operator+(iterator it, difference_type n) noexcept {
+			return it += n;
+		}
+
+		// The offset of the byte in the decoded output.
+		size_t pos() const noexcept {
+			return wp;
+		}
+
+		// Zero, or the error as returned by decompress<V>() if the iterator stopped at one.
+		ssize_t error() const noexcept {
+			return err;
+		}
+
+		bool operator==(const iterator &other) const noexcept {
+			return src == other.src && rp == other.rp && left == other.left && ip == other.ip;
+		}
+
+		bool operator==(std::default_sentinel_t) const noexcept {
+			return left == 0;
+		}
+
+	private:
+		// Decode ops from `rp` until one that has output, or the end.
+		void next_op() noexcept {
+			while (left == 0 && rp < slen) {
+				const decoded_op d = detail::decode_op<V>(src[rp++]);
+				switch (d.kind) {
+					case op::cpy:
+						if (d.cnt > slen - rp)
+							return stop();
+						ip = rp;
+						left = d.cnt;
+						rep = false;
+						rp += d.cnt;
+						break;
+					case op::rep:
+						if (!(rp < slen))
+							return stop();
+						ip = rp;
+						left = d.cnt;
+						rep = true;
+						++rp;
+						break;
+					case op::lit:
+						ip = rp - 1;
+						left = 1;
+						break;
+					case op::nop:
+						break;
+					case op::invalid:
+					default:
+						return stop();
+				}
+			}
+		}
+
+		void stop() noexcept {
+			err = ~(ssize_t)(rp & ((size_t)~0 >> 1UL));
+			rp = slen;
+			left = 0;
+		}
+
+		const uint8_t *src = nullptr;
+		size_t slen = 0;
+		size_t rp = 0;	// The next op.
+		size_t ip = 0;	// The current byte of the op.
+		size_t left = 0;	// Bytes left of the op, including the current.
+		size_t wp = 0;
+		ssize_t err = 0;
+		bool rep = false;
+	};
+
+	decoded_view() = default;
+	explicit decoded_view(std::span<const uint8_t> in) noexcept : src(in) {}
+
+	iterator begin() const noexcept {
+		return iterator(src);
+	}
+
+	std::default_sentinel_t end() const noexcept {
+		return std::default_sentinel;
+	}
+
+private:
+	std::span<const uint8_t> src;
+};
+
+// A codec with its own output buffer, allocated from a memory resource, and kept for the next call.
+//
+// The buffer is sized by compress_bound<V>() for compression, and by the exact size, which
+// takes a pass over the ops, for decompression. Once it has grown to hold the largest output
+// needed, coding allocates nothing, so a request loop does no heap allocation in steady state.
+// The methods return what compress<V>() and decompress<V>() do, or -1 if the buffer can't be
+// allocated, and output() is the output of the last call that succeeded.
+template <rle8_variant V>
+class coder {
+public:
+	explicit coder(std::pmr::memory_resource *resource = std::pmr::get_default_resource()) noexcept : mr(resource) {}
+	coder(const coder &) = delete;
+	coder &operator=(const coder &) = delete;
+	~coder() {
+		if (buf)
+			mr->deallocate(buf, cap, 1);
+	}
+
+	ssize_t compress(std::span<const uint8_t> in) noexcept {
+		if (!reserve(compress_bound<V>(in.size())))
+			return -1;
+		return done(rle_zoo::compress<V>(in, std::span<uint8_t>(buf, cap)));
+	}
+
+	ssize_t decompress(std::span<const uint8_t> in) noexcept {
+		ssize_t res = rle_zoo::decompress<V>(in, {});
+		if (res < 0)
+			return done(res);
+		if (!reserve((size_t)res))
+			return -1;
+		return done(rle_zoo::decompress<V>(in, std::span<uint8_t>(buf, cap)));
+	}
+
+	std::span<const uint8_t> output() const noexcept {
+		return { buf, len };
+	}
+
+	// Make room for `n` bytes of output up front. Returns false if it can't be allocated.
+	bool reserve(size_t n) noexcept {
+		if (n <= cap)
+			return true;
+		// Grow by half again at least, so slowly growing inputs don't reallocate every time.
+		const size_t newcap = std::max(n, cap + cap / 2);
+		uint8_t *p;
+		try {
+			p = (uint8_t *)mr->allocate(newcap, 1);
+		} catch (const std::bad_alloc &) {
+			return false;
+		}
+		if (buf)
+			mr->deallocate(buf, cap, 1);
+		buf = p;
+		cap = newcap;
+		len = 0;
+		return true;
+	}
+
+	size_t capacity() const noexcept {
+		return cap;
+	}
+
+private:
+	ssize_t done(ssize_t res) noexcept {
+		len = res >= 0 ? (size_t)res : 0;
+		return res;
+	}
+
+	std::pmr::memory_resource *mr;
+	uint8_t *buf = nullptr;
+	size_t cap = 0;
+	size_t len = 0;
+};
+
+} // namespace rle_zoo
+
+#endif
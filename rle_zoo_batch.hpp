@@ -0,0 +1,68 @@
+/*
+	Run-Length Encoder/Decoder (RLE), C++ Parallel Batch Coding
+	Copyright (c) 2022, Eddy L O Jansson. Licensed under The MIT License.
+
+	Batch versions of the codecs of rle_zoo.hpp, which code every buffer of
+	a range into the buffer at the same position of another range, under a
+	standard execution policy, so that std::execution::par spreads a batch
+	over all cores with the standard library's parallel backend.
+
+	With libstdc++, the parallel backend is TBB when its headers are found,
+	in which case the program must be linked with -ltbb. Without them, the
+	parallel policies run sequentially.
+
+	Requires C++20.
+
+	See https://github.com/eloj/rle-zoo
+*/
+#ifndef RLE_ZOO_BATCH_HPP
+#define RLE_ZOO_BATCH_HPP
+
+#include <algorithm>
+#include <execution>
+#include <type_traits>
+#include "rle_zoo.hpp"
+
+namespace rle_zoo {
+
+template <class R>
+concept input_buffers = std::ranges::forward_range<R> &&
+	std::convertible_to<std::ranges::range_reference_t<R>, std::span<const uint8_t>>;
+
+template <class R>
+concept output_buffers = std::ranges::forward_range<R> &&
+	std::convertible_to<std::ranges::range_reference_t<R>, std::span<uint8_t>>;
+
+template <class P>
+concept execution_policy = std::is_execution_policy_v<std::remove_cvref_t<P>>;
+
+// Compress `in[i]` into `out[i]` for every buffer of `in`, storing what compress<V>() returns in `res[i]`.
+// An output buffer without data, such as an empty span, gets the size needed, so the same call can size a batch.
+// Returns the number of buffers that failed.
+template <rle8_variant V, execution_policy P, input_buffers In, output_buffers Out>
+size_t compress_batch(P &&policy, const In &in, Out &&out, std::span<ssize_t> res) {
+	assert(std::ranges::distance(out) >= std::ranges::distance(in));
+	assert(res.size() >= (size_t)std::ranges::distance(in));
+	std::transform(std::forward<P>(policy), std::ranges::begin(in), std::ranges::end(in), std::ranges::begin(out), res.begin(),
+		[](std::span<const uint8_t> src, std::span<uint8_t> dest) noexcept {
+			return compress<V>(src, dest);
+		});
+	return (size_t)std::count_if(res.begin(), res.begin() + std::ranges::distance(in), [](ssize_t r) { return r < 0; });
+}
+
+// Decompress `in[i]` into `out[i]` for every buffer of `in`, storing what decompress<V>() returns in `res[i]`.
+// Returns the number of buffers that failed.
+template <rle8_variant V, execution_policy P, input_buffers In, output_buffers Out>
+size_t decompress_batch(P &&policy, const In &in, Out &&out, std::span<ssize_t> res) {
+	assert(std::ranges::distance(out) >= std::ranges::distance(in));
+	assert(res.size() >= (size_t)std::ranges::distance(in));
+	std::transform(std::forward<P>(policy), std::ranges::begin(in), std::ranges::end(in), std::ranges::begin(out), res.begin(),
+		[](std::span<const uint8_t> src, std::span<uint8_t> dest) noexcept {
+			return decompress<V>(src, dest);
+		});
+	return (size_t)std::count_if(res.begin(), res.begin() + std::ranges::distance(in), [](ssize_t r) { return r < 0; });
+}
+
+} // namespace rle_zoo
+
+#endif
@@ -0,0 +1,280 @@
+/*
+	Run-Length Encoder/Decoder (RLE), C++ Coroutine Streaming
+	Copyright (c) 2022, Eddy L O Jansson. Licensed under The MIT License.
+
+	Chunked streaming versions of the codecs of rle_zoo.hpp, as coroutines.
+
+	compress_chunks<V>() and decompress_chunks<V>() take their input as a
+	range of chunks, of any size, e.g a generator of the spans read from a
+	file or socket, and return a generator that yields the output a chunk
+	at a time, as soon as the caller's output buffer is full. Only the last
+	chunk may be shorter. Nothing runs except when the caller resumes the
+	generator, so encoding and decoding interleave with the I/O on the same
+	thread, and the state kept across chunks doesn't grow with the input.
+
+	The output is the same as that of compress<V>() and decompress<V>() over
+	the whole input. When done, `*res`, if given, is set to what they would
+	return, the total output size or an error. A yielded chunk is a view of
+	the output buffer, valid until the generator is resumed.
+
+	Requires C++20.
+
+	See https://github.com/eloj/rle-zoo
+*/
+#ifndef RLE_ZOO_STREAM_HPP
+#define RLE_ZOO_STREAM_HPP
+
+#include <algorithm>
+#include <coroutine>
+#include <exception>
+#include <utility>
+#include "rle_zoo.hpp"
+
+namespace rle_zoo {
+
+// A minimal synchronous generator, an input range of the values yielded by a coroutine.
+template <class T>
+class generator {
+public:
+	struct promise_type {
+		T value {};
+
+		generator get_return_object() noexcept {
+			return generator(std::coroutine_handle<promise_type>::from_promise(*this));
+		}
+		std::suspend_always initial_suspend() noexcept { return {}; }
+		std::suspend_always final_suspend() noexcept { return {}; }
+		std::suspend_always yield_value(T v) noexcept {
+			value = v;
+			return {};
+		}
+		void return_void() noexcept {}
+		// Exceptions thrown by the input range propagate to the caller.
+		void unhandled_exception() { throw; }
+	};
+
+	class iterator {
+	public:
+		using value_type = T;
+		using difference_type = ptrdiff_t;
+
+		iterator() = default;
+		explicit iterator(std::coroutine_handle<promise_type> handle) noexcept : h(handle) {}
+
+		const T &operator*() const noexcept {
+			return h.promise().value;
+		}
+		iterator &operator++() {
+			h.resume();
+			return *this;
+		}
+		void operator++(int) {
+			++*this;
+		}
+		bool operator==(std::default_sentinel_t) const noexcept {
+			return !h || h.done();
+		}
+
+	private:
+		std::coroutine_handle<promise_type> h;
+	};
+
+	generator(generator &&other) noexcept : h(std::exchange(other.h, {})) {}
+	generator &operator=(generator &&other) noexcept {
+		if (this != &other) {
+			if (h)
+				h.destroy();
+			h = std::exchange(other.h, {});
+		}
+		return *this;
+	}
+	~generator() {
+		if (h)
+			h.destroy();
+	}
+
+	iterator begin() {
+		if (h)
+			h.resume();
+		return iterator(h);
+	}
+	std::default_sentinel_t end() const noexcept {
+		return std::default_sentinel;
+	}
+
+private:
+	explicit generator(std::coroutine_handle<promise_type> handle) noexcept : h(handle) {}
+
+	std::coroutine_handle<promise_type> h;
+};
+
+template <class R>
+concept chunk_range = std::ranges::input_range<R> &&
+	std::convertible_to<std::ranges::range_reference_t<R>, std::span<const uint8_t>>;
+
+// Decompress the chunks of `in`, yielding the output in chunks of `buf.size()` bytes.
+// Stops at the first error. Every full buffer before it has already been yielded, and only the partly
+// filled one is dropped, so check `*res` before trusting the chunks already taken.
+template <rle8_variant V, chunk_range R>
+generator<std::span<const uint8_t>> decompress_chunks(R in, std::span<uint8_t> buf, ssize_t *res = nullptr) {
+	assert(!buf.empty());
+	size_t rp = 0;	// Of the whole input.
+	size_t wp = 0;
+	size_t n = 0;	// Bytes in `buf`.
+	op pending = op::nop;	// A CPY or REP waiting for its input, or NOP.
+	size_t left = 0;	// Bytes left of the CPY, or the count of the REP.
+	size_t op_rp = 0;	// Where the pending op ends, for the error.
+
+	for (std::span<const uint8_t> chunk : in) {
+		size_t ip = 0;
+		while (ip < chunk.size()) {
+			if (pending == op::nop) {
+				const uint8_t b = chunk[ip++];
+				const decoded_op d = detail::decode_op<V>(b);
+				++rp;
+				switch (d.kind) {
+					case op::cpy:
+					case op::rep:
+						pending = d.kind;
+						left = d.cnt;
+						op_rp = rp;
+						break;
+					case op::lit:
+						buf[n++] = b;
+						++wp;
+						break;
+					case op::nop:
+						break;
+					case op::invalid:
+					default:
+						if (res)
+							*res = ~(ssize_t)(rp & ((size_t)~0 >> 1UL));
+						co_return;
+				}
+			} else if (pending == op::rep) {
+				const uint8_t v = chunk[ip++];
+				++rp;
+				while (left > 0) {
+					const size_t k = std::min(left, buf.size() - n);
+					memset(buf.data() + n, v, k);
+					n += k;
+					wp += k;
+					left -= k;
+					if (n == buf.size()) {
+						co_yield buf;
+						n = 0;
+					}
+				}
+				pending = op::nop;
+			} else {
+				const size_t k = std::min({ left, chunk.size() - ip, buf.size() - n });
+				memcpy(buf.data() + n, chunk.data() + ip, k);
+				ip += k;
+				rp += k;
+				n += k;
+				wp += k;
+				left -= k;
+			}
+			if (pending == op::cpy && left == 0)
+				pending = op::nop;
+			if (n == buf.size()) {
+				co_yield buf;
+				n = 0;
+			}
+		}
+	}
+	if (pending != op::nop) {
+		if (res)
+			*res = ~(ssize_t)(op_rp & ((size_t)~0 >> 1UL));
+		co_return;
+	}
+	if (n > 0)
+		co_yield buf.first(n);
+	if (res)
+		*res = (ssize_t)wp;
+}
+
+// Compress the chunks of `in`, yielding the output in chunks of `buf.size()` bytes.
+//
+// The input is gathered into a window of twice the lookahead of the encoder, and encoded
+// while there's enough of it for the ops to be the same as if the input ended nowhere near.
+template <rle8_variant V, chunk_range R>
+generator<std::span<const uint8_t>> compress_chunks(R in, std::span<uint8_t> buf, ssize_t *res = nullptr) {
+	assert(!buf.empty());
+	std::array<uint8_t, 2 * lookahead<V>> win;
+	size_t wlen = 0;
+	size_t wrp = 0;
+	size_t wp = 0;
+	size_t n = 0;	// Bytes in `buf`.
+
+	auto it = std::ranges::begin(in);
+	std::span<const uint8_t> chunk;
+	size_t ip = 0;
+	bool first = true;
+	bool eof = false;
+
+	for (;;) {
+		// Fill the window. The current chunk stays valid until the iterator is incremented.
+		while (!eof && wlen < win.size()) {
+			if (ip == chunk.size()) {
+				if (!first)
+					++it;
+				first = false;
+				if (it == std::ranges::end(in)) {
+					eof = true;
+					break;
+				}
+				chunk = *it;
+				ip = 0;
+				continue;
+			}
+			const size_t k = std::min(win.size() - wlen, chunk.size() - ip);
+			memcpy(win.data() + wlen, chunk.data() + ip, k);
+			wlen += k;
+			ip += k;
+		}
+		if (wrp == wlen)
+			break;
+
+		while (wrp < wlen && (eof || wlen - wrp >= lookahead<V>)) {
+			size_t cnt;
+			const op kind = detail::encode_op<V>(win.data(), wlen, wrp, cnt);
+			if (kind != op::lit) {
+				buf[n++] = (uint8_t)(kind == op::rep ? encode_table<V, op::rep>[cnt] : encode_table<V, op::cpy>[cnt]);
+				++wp;
+				if (n == buf.size()) {
+					co_yield buf;
+					n = 0;
+				}
+			}
+			// The bytes of a LIT or CPY, or the value of a REP.
+			size_t m = kind == op::cpy ? cnt : 1;
+			const uint8_t *p = win.data() + wrp;
+			while (m > 0) {
+				const size_t k = std::min(m, buf.size() - n);
+				memcpy(buf.data() + n, p, k);
+				p += k;
+				m -= k;
+				n += k;
+				wp += k;
+				if (n == buf.size()) {
+					co_yield buf;
+					n = 0;
+				}
+			}
+			wrp += cnt;
+		}
+
+		memmove(win.data(), win.data() + wrp, wlen - wrp);
+		wlen -= wrp;
+		wrp = 0;
+	}
+	if (n > 0)
+		co_yield buf.first(n);
+	if (res)
+		*res = (ssize_t)wp;
+}
+
+} // namespace rle_zoo
+
+#endif
@@ -0,0 +1,12 @@
+#
+# SSI Goldbox. Codes 0x7E-0x80 are not used.
+#
+variant goldbox
+
+# op codes count [step]
+cpy 0x00-0x7D 1
+rep 0x81-0xFF 127 -1
+
+# Encoder policy
+min-rep 2
+rep-last
@@ -0,0 +1,13 @@
+#
+# Apple ICNS.
+#
+variant icns
+
+# op codes count [step]
+cpy 0x00-0x7F 1
+rep 0x80-0xFF 3
+
+# Encoder policy
+min-rep 3
+cpy-last
+cpy-lookback
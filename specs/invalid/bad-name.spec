@@ -0,0 +1,5 @@
+# Not a C identifier.
+variant foo-bar
+cpy 0x00-0x7F 1
+rep 0x80-0xFF 2
+min-rep 2
@@ -0,0 +1,5 @@
+# min-rep larger than the longest REP.
+variant w
+cpy 0x00-0x7F 1
+rep 0x80-0x81 2
+min-rep 4
@@ -0,0 +1,4 @@
+# No REP range.
+variant y
+cpy 0x00-0x7F 1
+min-rep 2
@@ -0,0 +1,4 @@
+# No REP range.
+variant x
+lit 0x00-0x7F
+min-rep 2
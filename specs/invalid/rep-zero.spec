@@ -0,0 +1,5 @@
+# Only a REP of zero bytes.
+variant z
+cpy 0x00-0x7F 1
+rep 0x80 0
+min-rep 2
@@ -0,0 +1,13 @@
+#
+# Apple PackBits, as described in Technical Note TN1023.
+#
+variant packbits
+
+# op codes count [step]
+cpy 0x00-0x7F 1
+nop 0x80
+rep 0x81-0xFF 128 -1
+
+# Encoder policy
+min-rep 2
+cpy-last
@@ -0,0 +1,11 @@
+#
+# ZSoft PCX. Bytes which can't be a LIT are stored as a REP of one.
+#
+variant pcx
+
+# op codes count [step]
+lit 0x00-0xBF
+rep 0xC0-0xFF 0
+
+# Encoder policy
+min-rep 2
@@ -0,0 +1,427 @@
+/*
+	Run-Length Encoding & Decoding C++ Interface Tests
+	Copyright (c) 2022, Eddy L O Jansson. Licensed under The MIT License.
+
+	See https://github.com/eloj/rle-zoo
+*/
+#define RLE_ZOO_IMPLEMENTATION
+#include "rle_goldbox.h"
+#include "rle_packbits.h"
+#include "rle_pcx.h"
+#include "rle_icns.h"
+#include "codec-goldbox.h"
+#include "codec-packbits.h"
+#include "codec-pcx.h"
+#include "codec-icns.h"
+
+#include "rle_zoo.hpp"
+#include "rle_zoo_stream.hpp"
+#include "rle_zoo_batch.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#define RED "\e[1;31m"
+#define GREEN "\e[0;32m"
+#define NC "\e[0m"
+
+#define TEST_ERRMSG(fmt, ...) \
+	fprintf(stderr,"%s:%zu:" RED " error: " NC fmt "\n", testname, i __VA_OPT__(,) __VA_ARGS__)
+
+using rle_zoo::op;
+
+// The traits are usable at compile time.
+static_assert(rle_zoo::decode_table<rle_zoo::packbits>[0x80].kind == op::nop);
+static_assert(rle_zoo::decode_table<rle_zoo::packbits>[0xFF].cnt == 2);
+static_assert(rle_zoo::encode_table<rle_zoo::packbits, op::rep>[128] == 0x81);
+static_assert(rle_zoo::encode_table<rle_zoo::icns, op::rep>[2] == -1);
+static_assert(rle_zoo::decode_table<rle_zoo::goldbox>[0x7E].kind == op::invalid);
+static_assert(rle_zoo::min_count<rle_zoo::icns, op::rep> == 3 && rle_zoo::max_count<rle_zoo::icns, op::rep> == 130);
+static_assert(rle_zoo::max_count<rle_zoo::pcx, op::cpy> == 0 && rle_zoo::max_count<rle_zoo::pcx, op::rep> == 63);
+static_assert(std::ranges::forward_range<rle_zoo::decoded_view<rle_zoo::packbits>>);
+static_assert(std::ranges::view<rle_zoo::decoded_view<rle_zoo::icns>>);
+
+typedef ssize_t (*rle_fp)(const uint8_t *src, size_t slen, uint8_t *dest, size_t dlen);
+
+struct cpp_codec {
+	const char *name;
+	ssize_t (*compress)(std::span<const uint8_t>, std::span<uint8_t>);
+	ssize_t (*decompress)(std::span<const uint8_t>, std::span<uint8_t>);
+	rle_fp c_compress;
+	rle_fp c_decompress;
+	rle_fp gen_decompress;
+	size_t (*check_view)(const char *testname, size_t i, const std::vector<uint8_t> &in);
+	size_t (*check_stream)(const char *testname, size_t i, const std::vector<uint8_t> &in);
+	size_t (*check_coder)(const char *testname, size_t i, const std::vector<std::vector<uint8_t>> &inputs);
+	size_t (*check_batch)(const char *testname, size_t i, const std::vector<std::vector<uint8_t>> &inputs);
+};
+
+// Code all the inputs as one batch under each policy, and compare against coding them one by one.
+template <rle_zoo::rle8_variant V, rle_zoo::execution_policy P>
+static size_t check_batch_policy(const char *testname, size_t i, P &&policy, const char *policy_name, const std::vector<std::vector<uint8_t>> &inputs) {
+	size_t fails = 0;
+	const size_t n = inputs.size();
+	std::vector<ssize_t> res(n);
+
+	// Size the outputs with the batch itself.
+	std::vector<std::span<uint8_t>> none(n);
+	size_t failed = rle_zoo::compress_batch<V>(policy, inputs, none, res);
+	std::vector<std::vector<uint8_t>> packed(n);
+	for (size_t k = 0 ; k < n ; ++k) {
+		if (res[k] != rle_zoo::compress<V>(inputs[k], {})) {
+			TEST_ERRMSG("%s: %s compress_batch size of %zu is %zd.", V::name, policy_name, k, res[k]);
+			return 1;
+		}
+		packed[k].resize((size_t)res[k]);
+	}
+
+	failed += rle_zoo::compress_batch<V>(policy, inputs, packed, res);
+	for (size_t k = 0 ; k < n ; ++k) {
+		std::vector<uint8_t> ref(rle_zoo::compress_bound<V>(inputs[k].size()));
+		ref.resize((size_t)rle_zoo::compress<V>(inputs[k], ref));
+		if (res[k] != (ssize_t)ref.size() || packed[k] != ref) {
+			TEST_ERRMSG("%s: %s compress_batch of %zu returned %zd, expected %zu, or output differs.", V::name, policy_name, k, res[k], ref.size());
+			++fails;
+		}
+	}
+
+	// Decode the inputs too, as noise, where some fail.
+	std::vector<std::vector<uint8_t>> unpacked(n);
+	for (size_t k = 0 ; k < n ; ++k)
+		unpacked[k].resize(inputs[k].size());
+	failed += rle_zoo::decompress_batch<V>(policy, packed, unpacked, res);
+	std::vector<std::vector<uint8_t>> noise(n, std::vector<uint8_t>(4096));
+	size_t noise_failed = rle_zoo::decompress_batch<V>(policy, inputs, noise, res);
+	size_t expected_failed = 0;
+	for (size_t k = 0 ; k < n ; ++k) {
+		std::vector<uint8_t> ref(4096);
+		ssize_t ref_res = rle_zoo::decompress<V>(inputs[k], ref);
+		expected_failed += ref_res < 0;
+		if (unpacked[k] != inputs[k] || res[k] != ref_res || (ref_res > 0 && !std::equal(ref.begin(), ref.begin() + ref_res, noise[k].begin()))) {
+			TEST_ERRMSG("%s: %s decompress_batch of %zu returned %zd, expected %zd, or output differs.", V::name, policy_name, k, res[k], ref_res);
+			++fails;
+		}
+	}
+	if (failed != 0 || noise_failed != expected_failed) {
+		TEST_ERRMSG("%s: %s batches failed %zu and %zu, expected 0 and %zu.", V::name, policy_name, failed, noise_failed, expected_failed);
+		++fails;
+	}
+	return fails;
+}
+
+template <rle_zoo::rle8_variant V>
+static size_t check_batch(const char *testname, size_t i, const std::vector<std::vector<uint8_t>> &inputs) {
+	return check_batch_policy<V>(testname, i, std::execution::seq, "seq", inputs) +
+		check_batch_policy<V>(testname, i, std::execution::par, "par", inputs) +
+		check_batch_policy<V>(testname, i, std::execution::par_unseq, "par_unseq", inputs);
+}
+
+// Counts the allocations that go through to the upstream resource.
+class counting_resource : public std::pmr::memory_resource {
+public:
+	size_t allocs = 0;
+
+private:
+	void *do_allocate(size_t bytes, size_t align) override {
+		++allocs;
+		return std::pmr::new_delete_resource()->allocate(bytes, align);
+	}
+	void do_deallocate(void *p, size_t bytes, size_t align) override {
+		std::pmr::new_delete_resource()->deallocate(p, bytes, align);
+	}
+	bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override {
+		return this == &other;
+	}
+};
+
+// Code every input in a loop with one coder, and check that it stops allocating after the first round.
+template <rle_zoo::rle8_variant V>
+static size_t check_coder(const char *testname, size_t i, const std::vector<std::vector<uint8_t>> &inputs) {
+	size_t fails = 0;
+	counting_resource mr;
+	rle_zoo::coder<V> enc(&mr);
+	rle_zoo::coder<V> dec(&mr);
+	std::vector<uint8_t> ref;
+
+	for (int round = 0 ; round < 2 ; ++round) {
+		size_t allocs = mr.allocs;
+		for (const std::vector<uint8_t> &in : inputs) {
+			ref.resize(rle_zoo::compress_bound<V>(in.size()));
+			ssize_t ref_res = rle_zoo::compress<V>(in, ref);
+			ssize_t res = enc.compress(in);
+			if (res != ref_res || !std::ranges::equal(enc.output(), std::span(ref).first((size_t)ref_res))) {
+				TEST_ERRMSG("%s: coder compress returned %zd, expected %zd, or output differs.", V::name, res, ref_res);
+				++fails;
+				continue;
+			}
+			res = dec.decompress(enc.output());
+			if (res != (ssize_t)in.size() || !std::ranges::equal(dec.output(), in)) {
+				TEST_ERRMSG("%s: coder decompress returned %zd, expected %zu, or output differs.", V::name, res, in.size());
+				++fails;
+			}
+			// Noise as an op stream.
+			ref.resize(64 * in.size() + 16);
+			ref_res = rle_zoo::decompress<V>(in, ref);
+			res = dec.decompress(in);
+			if (res != ref_res || (res >= 0 && !std::ranges::equal(dec.output(), std::span(ref).first((size_t)res)))) {
+				TEST_ERRMSG("%s: coder decompress returned %zd, expected %zd, or output differs.", V::name, res, ref_res);
+				++fails;
+			}
+		}
+		if (round > 0 && mr.allocs != allocs) {
+			TEST_ERRMSG("%s: coder allocated %zu times in steady state.", V::name, mr.allocs - allocs);
+			++fails;
+		}
+	}
+
+	// A fixed arena with no upstream fails cleanly when it runs out.
+	std::array<std::byte, 256> arena;
+	std::pmr::monotonic_buffer_resource mono(arena.data(), arena.size(), std::pmr::null_memory_resource());
+	rle_zoo::coder<V> small(&mono);
+	std::vector<uint8_t> big(1024, 'A');
+	if (small.compress(std::span(big).first(64)) < 0 || small.compress(big) != -1) {
+		TEST_ERRMSG("%s: coder didn't fail cleanly when out of memory.", V::name);
+		++fails;
+	}
+	return fails;
+}
+
+static std::vector<std::span<const uint8_t>> split(std::span<const uint8_t> in, size_t chunk_size) {
+	std::vector<std::span<const uint8_t>> chunks;
+	for (size_t ofs = 0 ; ofs < in.size() ; ofs += chunk_size)
+		chunks.push_back(in.subspan(ofs, std::min(chunk_size, in.size() - ofs)));
+	return chunks;
+}
+
+static std::vector<uint8_t> join(rle_zoo::generator<std::span<const uint8_t>> gen) {
+	std::vector<uint8_t> out;
+	for (std::span<const uint8_t> chunk : gen)
+		out.insert(out.end(), chunk.begin(), chunk.end());
+	return out;
+}
+
+// Stream `in` through the chunked codecs, with various input and output chunk sizes, and compare against the whole.
+template <rle_zoo::rle8_variant V>
+static size_t check_stream(const char *testname, size_t i, const std::vector<uint8_t> &in) {
+	size_t fails = 0;
+	std::vector<uint8_t> ref(64 * in.size() + 16);
+	ssize_t ref_res = rle_zoo::compress<V>(in, ref);
+	ref.resize(ref_res > 0 ? (size_t)ref_res : 0);
+	std::vector<uint8_t> dref(64 * in.size() + 16);
+	ssize_t dref_res = rle_zoo::decompress<V>(in, dref);
+	dref.resize(dref_res > 0 ? (size_t)dref_res : 0);
+
+	uint8_t buf[300];
+	for (size_t chunk_size : { 1, 3, 7, 64, 1000 }) {
+		for (size_t buf_size : { 1, 5, 300 }) {
+			ssize_t res = 0;
+			std::vector<uint8_t> out = join(rle_zoo::compress_chunks<V>(split(in, chunk_size), std::span(buf, buf_size), &res));
+			if (res != ref_res || out != ref) {
+				TEST_ERRMSG("%s: compress_chunks(%zu, %zu) returned %zd, expected %zd, or output differs.", V::name, chunk_size, buf_size, res, ref_res);
+				++fails;
+			}
+			out = join(rle_zoo::decompress_chunks<V>(split(in, chunk_size), std::span(buf, buf_size), &res));
+			if (res != dref_res || (res >= 0 && out != dref)) {
+				TEST_ERRMSG("%s: decompress_chunks(%zu, %zu) returned %zd, expected %zd, or output differs.", V::name, chunk_size, buf_size, res, dref_res);
+				++fails;
+			}
+		}
+	}
+
+	// Round trip from one generator to the other.
+	uint8_t cbuf[7];
+	ssize_t cres = 0, dres = 0;
+	std::vector<uint8_t> out = join(rle_zoo::decompress_chunks<V>(rle_zoo::compress_chunks<V>(split(in, 5), cbuf, &cres), buf, &dres));
+	if (out != in || cres != ref_res || dres != (ssize_t)in.size()) {
+		TEST_ERRMSG("%s: round trip through the generators failed.", V::name);
+		++fails;
+	}
+	return fails;
+}
+
+// Iterate, skip and search over the decoded view, and compare against decompress<V>().
+template <rle_zoo::rle8_variant V>
+static size_t check_view(const char *testname, size_t i, const std::vector<uint8_t> &in) {
+	size_t fails = 0;
+	rle_zoo::decoded_view<V> view(in);
+	std::vector<uint8_t> ref(64 * in.size() + 16);
+	ssize_t res = rle_zoo::decompress<V>(in, ref);
+	if (res >= 0) {
+		ref.resize((size_t)res);
+	} else {
+		// The view stops at the error, having produced what's before the op.
+		ref.resize((size_t)rle_zoo::decompress<V>(std::span(in).first((size_t)-(res + 1) - 1), {}));
+	}
+
+	auto it = view.begin();
+	size_t n = 0;
+	for ( ; it != std::default_sentinel ; ++it, ++n) {
+		if (n >= ref.size() || *it != ref[n] || it.pos() != n)
+			break;
+	}
+	if (n != ref.size() || it != std::default_sentinel || it.error() != (res < 0 ? res : 0)) {
+		TEST_ERRMSG("%s: view produced %zu bytes, error %zd, expected %zu, error %zd.", V::name, n, it.error(), ref.size(), res < 0 ? res : 0);
+		return 1;
+	}
+
+	for (size_t step : { 1, 2, 3, 127, 128, 129, 1000 }) {
+		it = view.begin();
+		for (size_t pos = 0 ; pos < ref.size() ; pos += step, it += (ptrdiff_t)step) {
+			if (it == std::default_sentinel || *it != ref[pos] || it.pos() != pos) {
+				TEST_ERRMSG("%s: skipping by %zu failed at %zu.", V::name, step, pos);
+				++fails;
+				break;
+			}
+		}
+	}
+
+	if (std::ranges::count(view, 'A') != std::ranges::count(ref, 'A')) {
+		TEST_ERRMSG("%s: count differs.", V::name);
+		++fails;
+	}
+	if (ref.size() > 2) {
+		auto needle = std::span(ref).subspan(ref.size() / 2, 2);
+		auto found = std::ranges::search(view, needle);
+		auto expected = std::ranges::search(ref, needle);
+		if (found.begin().pos() != (size_t)(expected.begin() - ref.begin())) {
+			TEST_ERRMSG("%s: search found %zu, expected %zd.", V::name, found.begin().pos(), expected.begin() - ref.begin());
+			++fails;
+		}
+	}
+	return fails;
+}
+
+template <rle_zoo::rle8_variant V>
+static constexpr cpp_codec make_codec(rle_fp c_compress, rle_fp c_decompress, rle_fp gen_decompress) {
+	return { V::name, rle_zoo::compress<V>, rle_zoo::decompress<V>, c_compress, c_decompress, gen_decompress, check_view<V>, check_stream<V>, check_coder<V>, check_batch<V> };
+}
+
+static const cpp_codec codecs[] = {
+	make_codec<rle_zoo::goldbox>(goldbox_compress, goldbox_decompress, goldbox_gen_decompress),
+	make_codec<rle_zoo::packbits>(packbits_compress, packbits_decompress, packbits_gen_decompress),
+	make_codec<rle_zoo::pcx>(pcx_compress, pcx_decompress, pcx_gen_decompress),
+	make_codec<rle_zoo::icns>(icns_compress, icns_decompress, icns_gen_decompress),
+};
+
+// Compare against the C functions on the same input, also with too little output space.
+static size_t check_compress(const char *testname, size_t i, const cpp_codec &c, const std::vector<uint8_t> &in) {
+	size_t fails = 0;
+	std::vector<uint8_t> out(2 * in.size() + 16), ref(2 * in.size() + 16);
+
+	ssize_t size = c.compress(in, {});
+	ssize_t ref_size = c.c_compress(in.data(), in.size(), NULL, 0);
+	if (size != ref_size) {
+		TEST_ERRMSG("%s: compress size %zd, expected %zd.", c.name, size, ref_size);
+		return 1;
+	}
+	for (size_t dlen : { out.size(), (size_t)size, size > 0 ? (size_t)size - 1 : 0 }) {
+		ssize_t res = c.compress(in, std::span<uint8_t>(out.data(), dlen));
+		ssize_t ref_res = c.c_compress(in.data(), in.size(), ref.data(), dlen);
+		if (res != ref_res || (res > 0 && memcmp(out.data(), ref.data(), (size_t)res) != 0)) {
+			TEST_ERRMSG("%s: compress into %zu bytes returned %zd, expected %zd, or output differs.", c.name, dlen, res, ref_res);
+			++fails;
+		}
+	}
+	return fails;
+}
+
+static size_t check_decompress(const char *testname, size_t i, const cpp_codec &c, const std::vector<uint8_t> &in) {
+	size_t fails = 0;
+	std::vector<uint8_t> out(64 * in.size() + 16), ref(64 * in.size() + 16);
+
+	for (size_t dlen : { out.size(), in.size() / 2 }) {
+		ssize_t res = c.decompress(in, std::span<uint8_t>(out.data(), dlen));
+		ssize_t ref_res = c.gen_decompress(in.data(), in.size(), ref.data(), dlen);
+		if (res != ref_res || (res > 0 && memcmp(out.data(), ref.data(), (size_t)res) != 0)) {
+			TEST_ERRMSG("%s: decompress into %zu bytes returned %zd, expected %zd, or output differs.", c.name, dlen, res, ref_res);
+			++fails;
+		}
+	}
+	ssize_t size = c.decompress(in, {});
+	ssize_t ref_size = c.gen_decompress(in.data(), in.size(), NULL, 0);
+	if (size != ref_size) {
+		TEST_ERRMSG("%s: decompress size %zd, expected %zd.", c.name, size, ref_size);
+		++fails;
+	}
+	return fails;
+}
+
+static int test_codecs(void) {
+	const char *testname = "rle_zoo.hpp";
+	size_t fails = 0;
+	size_t i = 0;
+
+	// Edge cases, short runs mixed with noise, and noise.
+	std::vector<std::vector<uint8_t>> inputs = {
+		{},
+		{ 'A' },
+		{ 'A', 'A' },
+		{ 'A', 'B' },
+		{ 'A', 'A', 'A', 'B' },
+		{ 'A', 'B', 'B', 'B' },
+		{ 0xC0, 0xFF, 0xC0 },
+		std::vector<uint8_t>(300, 'X'),
+	};
+	uint32_t x = 4711;
+	for (size_t n = 0 ; n < 64 ; ++n) {
+		std::vector<uint8_t> v(1 + n * 37);
+		for (size_t k = 0 ; k < v.size() ; ++k) {
+			x = x * 1103515245 + 12345;
+			v[k] = (x >> 28) < (n % 12) && k > 0 ? v[k - 1] : (uint8_t)(x >> 16);
+		}
+		inputs.push_back(v);
+	}
+
+	for (const cpp_codec &c : codecs) {
+		fails += c.check_coder(testname, i, inputs);
+		fails += c.check_batch(testname, i, inputs);
+		for (const std::vector<uint8_t> &in : inputs) {
+			fails += check_compress(testname, i, c, in);
+			fails += c.check_stream(testname, i, in);
+
+			std::vector<uint8_t> packed(2 * in.size() + 16);
+			ssize_t plen = c.c_compress(in.data(), in.size(), packed.data(), packed.size());
+			if (plen < 0) {
+				TEST_ERRMSG("%s: C compress failed.", c.name);
+				++fails;
+				continue;
+			}
+			packed.resize((size_t)plen);
+			fails += check_decompress(testname, i, c, packed);
+			fails += c.check_view(testname, i, packed);
+			// Truncated input.
+			if (packed.size() > 1) {
+				packed.pop_back();
+				fails += check_decompress(testname, i, c, packed);
+				fails += c.check_view(testname, i, packed);
+			}
+			// Noise as an op stream.
+			fails += check_decompress(testname, i, c, in);
+			fails += c.check_view(testname, i, in);
+			++i;
+		}
+	}
+
+	if (fails == 0) {
+		printf("Suite '%s' passed " GREEN "OK" NC "\n", testname);
+	}
+
+	return fails;
+}
+
+int main(void) {
+	size_t failed = 0;
+
+	failed += test_codecs();
+
+	if (failed != 0) {
+		printf("Tests " RED "FAILED" NC "\n");
+	} else {
+		printf("All tests " GREEN "passed OK" NC ".\n");
+	}
+
+	return failed == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
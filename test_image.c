@@ -0,0 +1,1363 @@
+/*
+	Image & Container Decoder Tests
+	Copyright (c) 2022, Eddy L O Jansson. Licensed under The MIT License.
+
+	See https://github.com/eloj/rle-zoo
+*/
+#define _GNU_SOURCE
+#define UTILITY_IMPLEMENTATION
+#include "utility.h"
+
+#define RLE_ZOO_IMPLEMENTATION
+// Use several threads even on single-core machines, to exercise the parallel paths.
+#define RLE_ZOO_THREADS 4
+#include "rle_tga.h"
+#include "rle_bmp.h"
+#include "rle_pict.h"
+#include "rle_pcx.h"
+#include "rle_pcx_image.h"
+#include "rle_icns.h"
+#include "rle_icns_image.h"
+#include "rle_packbits.h"
+#include "rle_ilbm_image.h"
+#include "rle_tiff_image.h"
+#include "rle_goldbox.h"
+#include "rle_goldbox_dax.h"
+#include "rle_psd_image.h"
+#include "rle_exepack.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <assert.h>
+
+#define RED "\e[1;31m"
+#define GREEN "\e[0;32m"
+#define YELLOW "\e[1;33m"
+#define NC "\e[0m"
+
+static int debug_hex = 1;
+
+#define TEST_ERRMSG(fmt, ...) \
+	fprintf(stderr,"%s:%zu:" RED " error: " NC fmt "\n", testname, i __VA_OPT__(,) __VA_ARGS__)
+
+// Value used to detect writes outside of the expected image area.
+#define GUARD 0xEE
+
+static int check_buf(const char *testname, size_t i, const uint8_t *got, const uint8_t *expected, size_t len) {
+	if (memcmp(got, expected, len) != 0) {
+		TEST_ERRMSG("output buffer contents mismatch.");
+		if (debug_hex) {
+			printf("expected:\n");
+			fprint_hex(stdout, expected, len, 32, "\n", 1);
+			printf("\ngot:\n");
+			fprint_hex(stdout, got, len, 32, "\n", 1);
+			printf("\n");
+		}
+		return 1;
+	}
+	return 0;
+}
+
+static int test_tga_image(void) {
+	const char *testname = "tga_decompress_image";
+	size_t fails = 0;
+
+	struct tga_test {
+		const char *input;
+		size_t len;
+		size_t psize;
+		size_t width;
+		size_t height;
+		ssize_t expected_res;
+		const char *expected_output; // packed rows, top to bottom in memory
+	} tests[] = {
+		// REP spanning rows, followed by CPY spanning rows.
+		{ "\x83RGB\x01rgbXYZ", 11, 3, 3, 2, 11, "RGBRGBRGBRGBrgbXYZ" },
+		{ "\x84" "AB\x00" "CD", 6, 2, 3, 2, 6, "ABABABABABCD" },
+		{ "\x85" "ABCD", 5, 4, 2, 3, 5, "ABCDABCDABCDABCDABCDABCD" },
+		{ "\x03wxyz\x83W", 7, 1, 4, 2, 7, "wxyzWWWW" },
+		// Trailing data after the image is not consumed.
+		{ "\x81RGBtrailer", 11, 3, 2, 1, 4, "RGBRGB" },
+		// Errors: packet overruns image, truncated input.
+		{ "\x84" "AB", 3, 2, 2, 2, -4, NULL },
+		{ "\x81RGB", 4, 3, 2, 2, -5, NULL },
+		{ "\x02RGBrgb", 7, 3, 3, 1, -2, NULL },
+	};
+
+	for (size_t i = 0 ; i < sizeof(tests)/sizeof(tests[0]) ; ++i) {
+		struct tga_test *test = &tests[i];
+		const size_t rowlen = test->width * test->psize;
+		const size_t pitch = rowlen + 5;
+		uint8_t buf[256];
+		assert(pitch * test->height <= sizeof(buf));
+
+		// Top-down, with padding between rows that must be left untouched.
+		memset(buf, GUARD, sizeof(buf));
+		ssize_t res = tga_decompress_image((const uint8_t*)test->input, test->len, buf, (ptrdiff_t)pitch, test->width, test->height, test->psize);
+		if (res != test->expected_res) {
+			TEST_ERRMSG("unexpected return-value, expected '%zd', got '%zd'.", test->expected_res, res);
+			++fails;
+			continue;
+		}
+		if (res < 0) {
+			continue;
+		}
+
+		for (size_t y = 0 ; y < test->height ; ++y) {
+			const uint8_t *expected = (const uint8_t*)test->expected_output + y * rowlen;
+			if (check_buf(testname, i, buf + y * pitch, expected, rowlen) != 0) {
+				++fails;
+				break;
+			}
+			for (size_t p = rowlen ; p < pitch ; ++p) {
+				if (buf[y * pitch + p] != GUARD) {
+					TEST_ERRMSG("write into row padding detected at row %zu.", y);
+					++fails;
+					break;
+				}
+			}
+		}
+
+		// Bottom-up, via negative pitch; the first decoded row must end up last.
+		memset(buf, GUARD, sizeof(buf));
+		uint8_t *last = buf + (test->height - 1) * pitch;
+		res = tga_decompress_image((const uint8_t*)test->input, test->len, last, -(ptrdiff_t)pitch, test->width, test->height, test->psize);
+		for (size_t y = 0 ; y < test->height ; ++y) {
+			const uint8_t *expected = (const uint8_t*)test->expected_output + y * rowlen;
+			if (check_buf(testname, i, last - y * pitch, expected, rowlen) != 0) {
+				++fails;
+				break;
+			}
+		}
+
+		// The image decoder must agree with the flat decoder when rows are packed.
+		memset(buf, GUARD, sizeof(buf));
+		ssize_t flat = tga_decompress((const uint8_t*)test->input, (size_t)res, buf, sizeof(buf), test->psize);
+		if (flat != (ssize_t)(rowlen * test->height)) {
+			TEST_ERRMSG("flat decoder length mismatch, expected '%zu', got '%zd'.", rowlen * test->height, flat);
+			++fails;
+		} else if (check_buf(testname, i, buf, (const uint8_t*)test->expected_output, (size_t)flat) != 0) {
+			++fails;
+		}
+	}
+
+	if (fails == 0) {
+		printf("Suite '%s' passed " GREEN "OK" NC "\n", testname);
+	}
+
+	return fails;
+}
+
+static int test_bmp_image(void) {
+	const char *testname = "bmp_decompress_image";
+	size_t fails = 0;
+
+	struct bmp_test {
+		const char *input;
+		size_t len;
+		int bpp;
+		size_t width;
+		size_t height;
+		size_t pitch;
+		ssize_t expected_res;
+		const char *expected_output; // whole rows incl. padding, GUARD where nothing may be written
+	} tests[] = {
+		// RLE8: REP, delta, EOL, absolute with pad byte, EOB.
+		{ "\x02" "A" "\x00\x02\x01\x01" "\x01" "B" "\x00\x00" "\x00\x03" "xyz" "\x00" "\x00\x01", 16, 8, 4, 3, 5, 16,
+			"AA\xEE\xEE\xEE" "\xEE\xEE\xEE" "B\xEE" "xyz\xEE\xEE" },
+		// RLE4: nibble fills and copies at both even and odd pixel offsets.
+		{ "\x03\x12" "\x00\x03\x34\x50" "\x00\x00"
+		  "\x00\x02\x01\x00" "\x04\x67" "\x00\x00"
+		  "\x00\x05\xAB\xCD\xF0\x00" "\x00\x03\x12\x30" "\x00\x01", 28, 4, 8, 3, 5, 28,
+			"\x12\x13\x45\xEE\xEE" "\xE6\x76\x7E\xEE\xEE" "\xAB\xCD\xF1\x23\xEE" },
+		// Data after end-of-bitmap is not consumed.
+		{ "\x04" "A" "\x00\x01" "trailer", 11, 8, 4, 1, 4, 4, "AAAA" },
+		// Errors: run past end of row, delta outside the bitmap, write below the last row.
+		{ "\x05" "A", 2, 8, 4, 1, 4, -3, NULL },
+		{ "\x00\x02\x05\x00", 4, 8, 4, 1, 4, -5, NULL },
+		{ "\x00\x00" "\x01" "A", 4, 8, 4, 1, 4, -5, NULL },
+	};
+
+	for (size_t i = 0 ; i < sizeof(tests)/sizeof(tests[0]) ; ++i) {
+		struct bmp_test *test = &tests[i];
+		uint8_t buf[256];
+		assert(test->pitch * test->height <= sizeof(buf));
+		memset(buf, GUARD, sizeof(buf));
+
+		ssize_t res;
+		if (test->bpp == 8) {
+			res = bmp_rle8_decompress_image((const uint8_t*)test->input, test->len, buf, (ptrdiff_t)test->pitch, test->width, test->height);
+		} else {
+			res = bmp_rle4_decompress_image((const uint8_t*)test->input, test->len, buf, (ptrdiff_t)test->pitch, test->width, test->height);
+		}
+		if (res != test->expected_res) {
+			TEST_ERRMSG("unexpected return-value, expected '%zd', got '%zd'.", test->expected_res, res);
+			++fails;
+			continue;
+		}
+		if (res >= 0 && check_buf(testname, i, buf, (const uint8_t*)test->expected_output, test->pitch * test->height) != 0) {
+			++fails;
+		}
+	}
+
+	// Round-trip a bottom-up RLE8 bitmap through the image encoder and decoder.
+	{
+		size_t i = sizeof(tests)/sizeof(tests[0]);
+		enum { W = 13, H = 5, PITCH = 16 };
+		uint8_t img[PITCH * H];
+		uint8_t out[PITCH * H];
+		uint8_t enc[512];
+		for (size_t p = 0 ; p < sizeof(img) ; ++p) {
+			img[p] = (uint8_t)((p % 7 < 3) ? 'R' : 'a' + p % 5);
+		}
+		memset(out, GUARD, sizeof(out));
+
+		ssize_t elen = bmp_rle8_compress_image(img + (H - 1) * PITCH, -PITCH, W, H, NULL, 0);
+		ssize_t res = bmp_rle8_compress_image(img + (H - 1) * PITCH, -PITCH, W, H, enc, sizeof(enc));
+		if (elen <= 0 || res != elen) {
+			TEST_ERRMSG("encoded length mismatch, determined '%zd', got '%zd'.", elen, res);
+			++fails;
+		} else if (memcmp(enc + res - 4, "\x00\x00\x00\x01", 4) != 0) {
+			TEST_ERRMSG("encoded bitmap does not end with EOL, EOB.");
+			++fails;
+		} else {
+			res = bmp_rle8_decompress_image(enc, (size_t)elen, out + (H - 1) * PITCH, -PITCH, W, H);
+			if (res != elen) {
+				TEST_ERRMSG("decoder consumed '%zd' of '%zd' bytes.", res, elen);
+				++fails;
+			}
+			for (size_t y = 0 ; y < H ; ++y) {
+				if (check_buf(testname, i, out + y * PITCH, img + y * PITCH, W) != 0) {
+					++fails;
+					break;
+				}
+			}
+		}
+	}
+
+	if (fails == 0) {
+		printf("Suite '%s' passed " GREEN "OK" NC "\n", testname);
+	}
+
+	return fails;
+}
+
+static int test_pict_image(void) {
+	const char *testname = "pict_decompress_image";
+	size_t fails = 0;
+
+	struct pict_test {
+		const char *input;
+		size_t len;
+		size_t rowbytes;
+		size_t height;
+		size_t psize;
+		ssize_t expected_res;
+		const char *expected_output; // packed rows
+	} tests[] = {
+		// Byte mode, with one-byte counts.
+		{ "\x02\xF9" "A" "\x09\x07" "01234567" "\x07\xFD" "x" "\x03" "abcd", 21, 8, 3, 1, 21, "AAAAAAAA01234567xxxxabcd" },
+		// Word mode.
+		{ "\x03\xFD" "AB" "\x06\xFE" "AB" "\x00" "CD", 11, 8, 2, 2, 11, "ABABABABABABABCD" },
+		// Rows of less than eight bytes are not packed.
+		{ "abcdefgh", 8, 4, 2, 1, 8, "abcdefgh" },
+		// Trailing data after the image is not consumed.
+		{ "\x02\xF9" "Atrailer", 10, 8, 1, 1, 3, "AAAAAAAA" },
+		// Errors: short row, row overrun, missing count, count past end of input, lowest failing row wins.
+		{ "\x02\xFA" "A", 3, 8, 1, 1, -4, NULL },
+		{ "\x02\xF8" "A", 3, 8, 1, 1, -3, NULL },
+		{ "\x02\xF9" "A", 3, 8, 2, 1, -4, NULL },
+		{ "\x05\xF9" "A", 3, 8, 1, 1, -2, NULL },
+		{ "\x02\xF9" "A" "\x02\xFA" "A" "\x01\x80", 8, 8, 3, 1, -7, NULL },
+	};
+
+	for (size_t i = 0 ; i < sizeof(tests)/sizeof(tests[0]) ; ++i) {
+		struct pict_test *test = &tests[i];
+		const size_t pitch = test->rowbytes + 3;
+		uint8_t buf[256];
+		assert(pitch * test->height <= sizeof(buf));
+		memset(buf, GUARD, sizeof(buf));
+
+		ssize_t res = pict_decompress_image((const uint8_t*)test->input, test->len, buf, (ptrdiff_t)pitch, test->rowbytes, test->height, test->psize);
+		if (res != test->expected_res) {
+			TEST_ERRMSG("unexpected return-value, expected '%zd', got '%zd'.", test->expected_res, res);
+			++fails;
+			continue;
+		}
+		for (size_t y = 0 ; res >= 0 && y < test->height ; ++y) {
+			const uint8_t *expected = (const uint8_t*)test->expected_output + y * test->rowbytes;
+			if (check_buf(testname, i, buf + y * pitch, expected, test->rowbytes) != 0 || buf[y * pitch + test->rowbytes] != GUARD) {
+				++fails;
+				break;
+			}
+		}
+	}
+
+	// Round-trip images large enough to be decoded in several bands, bottom-up, with two-byte counts.
+	for (size_t psize = 1 ; psize <= 2 ; ++psize) {
+		size_t i = sizeof(tests)/sizeof(tests[0]) + psize - 1;
+		enum { ROWBYTES = 1000, H = 200, PITCH = 1024 };
+		uint8_t *img = malloc(PITCH * H);
+		uint8_t *out = malloc(PITCH * H);
+		uint8_t *enc = malloc(PITCH * H * 2);
+		assert(img && out && enc);
+		for (size_t p = 0 ; p < PITCH * H ; ++p) {
+			img[p] = (uint8_t)(((p / 97) & 1) ? p * 31 / 7 : p / 97);
+		}
+		memset(out, GUARD, PITCH * H);
+
+		uint8_t *last = img + (H - 1) * PITCH;
+		ssize_t elen = pict_compress_image(last, -PITCH, ROWBYTES, H, psize, NULL, 0);
+		ssize_t res = pict_compress_image(last, -PITCH, ROWBYTES, H, psize, enc, PITCH * H * 2);
+		if (elen <= 0 || res != elen) {
+			TEST_ERRMSG("encoded length mismatch, determined '%zd', got '%zd'.", elen, res);
+			++fails;
+		} else {
+			res = pict_decompress_image(enc, (size_t)elen, out + (H - 1) * PITCH, -PITCH, ROWBYTES, H, psize);
+			if (res != elen) {
+				TEST_ERRMSG("decoder consumed '%zd' of '%zd' bytes.", res, elen);
+				++fails;
+			}
+			for (size_t y = 0 ; y < H ; ++y) {
+				if (check_buf(testname, i, out + y * PITCH, img + y * PITCH, ROWBYTES) != 0 || out[y * PITCH + ROWBYTES] != GUARD) {
+					++fails;
+					break;
+				}
+			}
+		}
+		free(enc);
+		free(out);
+		free(img);
+	}
+
+	if (fails == 0) {
+		printf("Suite '%s' passed " GREEN "OK" NC "\n", testname);
+	}
+
+	return fails;
+}
+
+// Write a PCX header for an image at 0,0 into `buf`.
+static void make_pcx_header(uint8_t *buf, size_t width, size_t height, unsigned int bpp, unsigned int nplanes, size_t bpl) {
+	memset(buf, 0, PCX_HEADER_SIZE);
+	buf[0] = 0x0A;
+	buf[1] = 5;
+	buf[2] = 1;
+	buf[3] = (uint8_t)bpp;
+	buf[8] = (uint8_t)(width - 1);
+	buf[9] = (uint8_t)((width - 1) >> 8);
+	buf[10] = (uint8_t)(height - 1);
+	buf[11] = (uint8_t)((height - 1) >> 8);
+	buf[65] = (uint8_t)nplanes;
+	buf[66] = (uint8_t)bpl;
+	buf[67] = (uint8_t)(bpl >> 8);
+}
+
+static int test_pcx_image(void) {
+	const char *testname = "pcx_image_decode";
+	size_t fails = 0;
+	size_t i = 0;
+	struct pcx_image img;
+
+	// 8-bit indexed, with runs crossing lines, a 256-colour palette, and padding in bytes_per_line.
+	{
+		const uint8_t data[] = { 0xC7, 'a', 'b', 0xC5, 'c', 'd', 0xC1, 0xC1, 'e' };
+		uint8_t file[PCX_HEADER_SIZE + sizeof(data) + 769];
+		const size_t flen = sizeof(file);
+		make_pcx_header(file, 3, 4, 8, 1, 4);
+		memcpy(file + PCX_HEADER_SIZE, data, sizeof(data));
+		file[PCX_HEADER_SIZE + sizeof(data)] = 0x0C;
+		memset(file + PCX_HEADER_SIZE + sizeof(data) + 1, 0xAA, 768);
+
+		uint8_t buf[4 * 8];
+		memset(buf, GUARD, sizeof(buf));
+		if (pcx_image_parse(file, flen, &img) != 0 || img.palette256 != file + flen - 768 || img.data_len != sizeof(data)) {
+			TEST_ERRMSG("failed to parse header or find palette.");
+			++fails;
+		} else if (pcx_image_rowlen(&img, PCX_FORMAT_RGB) != 0) {
+			TEST_ERRMSG("RGB output offered for an indexed image.");
+			++fails;
+		} else {
+			ssize_t res = pcx_image_decode(&img, file, flen, PCX_FORMAT_INDEXED, buf, 8);
+			if (res != (ssize_t)(PCX_HEADER_SIZE + sizeof(data))) {
+				TEST_ERRMSG("unexpected return-value, expected '%zu', got '%zd'.", PCX_HEADER_SIZE + sizeof(data), res);
+				++fails;
+			}
+			fails += check_buf(testname, i, buf, (const uint8_t*)"aaa\xEE\xEE\xEE\xEE\xEE" "aaa\xEE\xEE\xEE\xEE\xEE" "ccc\xEE\xEE\xEE\xEE\xEE" "cd\xC1\xEE\xEE\xEE\xEE\xEE", sizeof(buf));
+			memset(buf, GUARD, sizeof(buf));
+			res = pcx_image_decode(&img, file, flen, PCX_FORMAT_RAW, buf, 8);
+			fails += check_buf(testname, i, buf, (const uint8_t*)"aaaa\xEE\xEE\xEE\xEE" "aaab\xEE\xEE\xEE\xEE" "cccc\xEE\xEE\xEE\xEE" "cd\xC1" "e\xEE\xEE\xEE\xEE", sizeof(buf));
+		}
+		++i;
+
+		// Errors: truncated data, and a run overrunning the image.
+		img.data_len = 8;
+		ssize_t res = pcx_image_decode(&img, file, flen, PCX_FORMAT_INDEXED, buf, 8);
+		if (res != -(ssize_t)(PCX_HEADER_SIZE + 8 + 1)) {
+			TEST_ERRMSG("unexpected return-value, expected '%zd', got '%zd'.", -(ssize_t)(PCX_HEADER_SIZE + 8 + 1), res);
+			++fails;
+		}
+		++i;
+		file[PCX_HEADER_SIZE + 6] = 0xC3;
+		img.data_len = sizeof(data);
+		res = pcx_image_decode(&img, file, flen, PCX_FORMAT_INDEXED, buf, 8);
+		if (res != -(ssize_t)(PCX_HEADER_SIZE + 8 + 1)) {
+			TEST_ERRMSG("unexpected return-value, expected '%zd', got '%zd'.", -(ssize_t)(PCX_HEADER_SIZE + 8 + 1), res);
+			++fails;
+		}
+		++i;
+
+		file[0] = 0x0B;
+		if (pcx_image_parse(file, flen, &img) != -1) {
+			TEST_ERRMSG("accepted bad header.");
+			++fails;
+		}
+		++i;
+	}
+
+	// 24-bit planar, large enough to be decoded in several bands, into RGB and RGBA.
+	for (unsigned int nplanes = 3 ; nplanes <= 4 ; ++nplanes, ++i) {
+		enum { W = 300, H = 300, BPL = 302 };
+		uint8_t *planes = malloc(BPL * nplanes * H);
+		uint8_t *file = malloc(PCX_HEADER_SIZE + BPL * nplanes * H * 2);
+		uint8_t *out = malloc(W * 4 * H);
+		uint8_t *expected = malloc(W * 4);
+		assert(planes && file && out && expected);
+
+		for (size_t p = 0 ; p < (size_t)BPL * nplanes * H ; ++p) {
+			planes[p] = (uint8_t)(((p / 13) & 1) ? p * 7 : p / 29);
+		}
+		make_pcx_header(file, W, H, 8, nplanes, BPL);
+		ssize_t flen = pcx_compress(planes, BPL * nplanes * H, file + PCX_HEADER_SIZE, BPL * nplanes * H * 2);
+		assert(flen > 0);
+		flen += PCX_HEADER_SIZE;
+
+		if (pcx_image_parse(file, (size_t)flen, &img) != 0) {
+			TEST_ERRMSG("failed to parse header.");
+			++fails;
+			continue;
+		}
+		for (int fmt = PCX_FORMAT_RGB ; fmt <= PCX_FORMAT_RGBA ; ++fmt) {
+			const size_t psize = fmt == PCX_FORMAT_RGB ? 3 : 4;
+			memset(out, GUARD, W * 4 * H);
+			ssize_t res = pcx_image_decode(&img, file, (size_t)flen, (enum pcx_format)fmt, out + (H - 1) * W * psize, -(ptrdiff_t)(W * psize));
+			if (res != flen) {
+				TEST_ERRMSG("unexpected return-value, expected '%zd', got '%zd'.", flen, res);
+				++fails;
+				continue;
+			}
+			for (size_t y = 0 ; y < H ; ++y) {
+				const uint8_t *line = planes + y * BPL * nplanes;
+				for (size_t x = 0 ; x < W ; ++x) {
+					for (size_t c = 0 ; c < psize ; ++c)
+						expected[x * psize + c] = c < nplanes ? line[c * BPL + x] : 0xFF;
+				}
+				if (check_buf(testname, i, out + (H - 1 - y) * W * psize, expected, W * psize) != 0) {
+					++fails;
+					break;
+				}
+			}
+		}
+		free(expected);
+		free(out);
+		free(file);
+		free(planes);
+	}
+
+	if (fails == 0) {
+		printf("Suite '%s' passed " GREEN "OK" NC "\n", testname);
+	}
+
+	return fails;
+}
+
+// Append an ICNS element of `type`, with `prefix` bytes of prefix, then `len` bytes of `data`
+// compressed with icns_compress() if `compress` is set.
+static size_t add_icns_element(uint8_t *buf, size_t wp, const char *type, const char *prefix, size_t prefix_len, const uint8_t *data, size_t len, int compress) {
+	size_t start = wp;
+	memcpy(buf + wp, type, 4);
+	wp += 8;
+	if (prefix_len > 0)
+		memcpy(buf + wp, prefix, prefix_len);
+	wp += prefix_len;
+	if (compress) {
+		ssize_t res = icns_compress(data, len, buf + wp, 65536);
+		assert(res > 0);
+		wp += (size_t)res;
+	} else {
+		memcpy(buf + wp, data, len);
+		wp += len;
+	}
+	size_t elen = wp - start;
+	for (int i = 0 ; i < 4 ; ++i)
+		buf[start + 4 + i] = (uint8_t)(elen >> (24 - 8 * i));
+	return wp;
+}
+
+static int test_icns_image(void) {
+	const char *testname = "icns_decode_rgba";
+	size_t fails = 0;
+	size_t i = 0;
+
+	// Planes for the largest icon, in ARGB order; RGB icons use the last three.
+	enum { N = 128 * 128 };
+	uint8_t *planes = malloc(4 * N);
+	uint8_t *file = malloc(65536 * 4);
+	uint8_t *out = malloc(4 * N + 4 * 128);
+	assert(planes && file && out);
+	for (size_t p = 0 ; p < N ; ++p) {
+		planes[p] = (uint8_t)(p * 3);
+		planes[N + p] = (uint8_t)(p % 128);
+		planes[2 * N + p] = (uint8_t)(p / 128);
+		planes[3 * N + p] = (p & 64) ? 0x40 : (uint8_t)(p * 7 / 3);
+	}
+
+	// The RGB channels of each icon are compressed back to back, so pack them together first.
+	uint8_t *tmp = malloc(4 * N);
+	assert(tmp);
+	size_t wp = 8;
+	for (size_t c = 0 ; c < 3 ; ++c)
+		memcpy(tmp + c * 32 * 32, planes + (c + 1) * N, 32 * 32);
+	wp = add_icns_element(file, wp, "il32", NULL, 0, tmp, 3 * 32 * 32, 1);
+	wp = add_icns_element(file, wp, "ic05", "\x89PNG", 4, planes, 64, 0);
+	wp = add_icns_element(file, wp, "it32", "\0\0\0\0", 4, planes + N, 3 * N, 1);
+	wp = add_icns_element(file, wp, "l8mk", NULL, 0, planes, 32 * 32, 0);
+	for (size_t c = 0 ; c < 4 ; ++c)
+		memcpy(tmp + c * 16 * 16, planes + c * N, 16 * 16);
+	wp = add_icns_element(file, wp, "ic04", "ARGB", 4, tmp, 4 * 16 * 16, 1);
+	memcpy(file, "icns", 4);
+	for (int k = 0 ; k < 4 ; ++k)
+		file[4 + k] = (uint8_t)(wp >> (24 - 8 * k));
+	free(tmp);
+
+	struct icns_icon icons[4];
+	int found = icns_parse(file, wp, icons, 4);
+	if (found != 3) {
+		TEST_ERRMSG("expected to find three icons, got %d.", found);
+		++fails;
+		found = 0;
+	}
+
+	for (int k = 0 ; k < found ; ++k, ++i) {
+		const struct icns_icon *icon = &icons[k];
+		const size_t w = icon->width;
+		const size_t pitch = 4 * w + 4;
+		memset(out, GUARD, 4 * N + 4 * 128);
+		ssize_t res = icns_decode_rgba(icon, out, (ptrdiff_t)pitch);
+		if (res != (ssize_t)icon->len) {
+			TEST_ERRMSG("unexpected return-value, expected '%zu', got '%zd'.", icon->len, res);
+			++fails;
+			continue;
+		}
+		for (size_t y = 0 ; y < w ; ++y) {
+			uint8_t expected[4 * 128 + 1];
+			for (size_t x = 0 ; x < w ; ++x) {
+				// Each channel was taken from the start of its plane.
+				size_t p = y * w + x;
+				for (size_t c = 0 ; c < 3 ; ++c)
+					expected[4 * x + c] = planes[(c + 1) * N + p];
+				if (icon->nchannels == 4)
+					expected[4 * x + 3] = planes[p];
+				else
+					expected[4 * x + 3] = icon->mask ? planes[p] : 0xFF;
+			}
+			expected[4 * w] = GUARD;
+			if (check_buf(testname, i, out + y * pitch, expected, 4 * w + 1) != 0) {
+				++fails;
+				break;
+			}
+		}
+	}
+	if (found == 3 && (icons[0].mask == NULL || icons[1].mask != NULL)) {
+		TEST_ERRMSG("icon masks not paired correctly.");
+		++fails;
+	}
+
+	// Decode many icons at once, including a truncated one.
+	if (found == 3) {
+		enum { NUM = 40 };
+		struct icns_icon batch[NUM];
+		uint8_t *dests[NUM];
+		ssize_t results[NUM];
+		for (size_t k = 0 ; k < NUM ; ++k) {
+			batch[k] = icons[k % 3];
+			dests[k] = malloc(4 * N);
+			assert(dests[k]);
+		}
+		batch[7].len -= 1;
+		size_t failed = icns_decode_rgba_batch(batch, NUM, dests, results);
+		if (failed != 1 || results[7] >= 0) {
+			TEST_ERRMSG("expected one failed icon, got %zu.", failed);
+			++fails;
+		}
+		for (size_t k = 0 ; k < NUM ; ++k) {
+			if (k != 7 && (results[k] != (ssize_t)batch[k].len || memcmp(dests[k], dests[k % 3], 4 * batch[k].width * batch[k].width) != 0)) {
+				TEST_ERRMSG("batch decoding mismatch for icon %zu.", k);
+				++fails;
+			}
+		}
+		for (size_t k = 0 ; k < NUM ; ++k)
+			free(dests[k]);
+		++i;
+	}
+
+	if (icns_parse(file + 1, wp - 1, icons, 4) != -1) {
+		TEST_ERRMSG("accepted bad header.");
+		++fails;
+	}
+
+	free(out);
+	free(file);
+	free(planes);
+
+	if (fails == 0) {
+		printf("Suite '%s' passed " GREEN "OK" NC "\n", testname);
+	}
+
+	return fails;
+}
+
+static size_t put_be32(uint8_t *buf, size_t wp, size_t v) {
+	for (int k = 0 ; k < 4 ; ++k)
+		buf[wp + (size_t)k] = (uint8_t)(v >> (24 - 8 * k));
+	return wp + 4;
+}
+
+// Build an ILBM file of `width` by `height` pixels, where pixel (x, y) is (x * 7 + y * 3) modulo the number of colors.
+static size_t make_ilbm(uint8_t *buf, size_t width, size_t height, unsigned int nplanes, unsigned int masking, unsigned int compression) {
+	const size_t stride = ((width + 15) / 16) * 2;
+	const size_t rowplanes = nplanes + (masking == ILBM_MASK_HAS_MASK ? 1 : 0);
+	size_t wp = 0;
+
+	memcpy(buf, "FORM\0\0\0\0ILBM", 12);
+	wp = 12;
+	memcpy(buf + wp, "BMHD", 4);
+	wp = put_be32(buf, wp + 4, 20);
+	memset(buf + wp, 0, 20);
+	buf[wp + 0] = (uint8_t)(width >> 8);
+	buf[wp + 1] = (uint8_t)width;
+	buf[wp + 2] = (uint8_t)(height >> 8);
+	buf[wp + 3] = (uint8_t)height;
+	buf[wp + 8] = (uint8_t)nplanes;
+	buf[wp + 9] = (uint8_t)masking;
+	buf[wp + 10] = (uint8_t)compression;
+	wp += 20;
+	// An odd-length chunk, to check the padding is skipped.
+	memcpy(buf + wp, "ANNO", 4);
+	wp = put_be32(buf, wp + 4, 3);
+	memcpy(buf + wp, "hi\0\0", 4);
+	wp += 4;
+	memcpy(buf + wp, "BODY", 4);
+	size_t body = wp + 4;
+	wp += 8;
+
+	uint8_t row[32];
+	assert(stride <= sizeof(row));
+	for (size_t y = 0 ; y < height ; ++y) {
+		for (size_t p = 0 ; p < rowplanes ; ++p) {
+			memset(row, 0, stride);
+			for (size_t x = 0 ; x < width ; ++x) {
+				size_t pixel = (x * 7 + y * 3) & ((1u << nplanes) - 1);
+				// The mask plane gets a pattern of its own.
+				size_t bit = p < nplanes ? (pixel >> p) & 1 : (x + y) & 1;
+				row[x / 8] |= (uint8_t)(bit << (7 - (x & 7)));
+			}
+			if (compression == ILBM_COMPRESSION_BYTERUN1) {
+				ssize_t res = packbits_compress(row, stride, buf + wp, 256);
+				assert(res > 0);
+				wp += (size_t)res;
+			} else {
+				memcpy(buf + wp, row, stride);
+				wp += stride;
+			}
+		}
+	}
+	put_be32(buf, body, wp - body - 4);
+	put_be32(buf, 4, wp - 8);
+	return wp;
+}
+
+static int test_ilbm_image(void) {
+	const char *testname = "ilbm_image_decode";
+	size_t fails = 0;
+	size_t i = 0;
+
+	const struct {
+		size_t width;
+		size_t height;
+		unsigned int nplanes;
+		unsigned int masking;
+		unsigned int compression;
+	} tests[] = {
+		{ 40, 5, 5, ILBM_MASK_HAS_MASK, ILBM_COMPRESSION_BYTERUN1 },
+		{ 48, 3, 8, ILBM_MASK_NONE, ILBM_COMPRESSION_BYTERUN1 },
+		{ 13, 4, 1, ILBM_MASK_NONE, ILBM_COMPRESSION_BYTERUN1 },
+		{ 33, 4, 3, ILBM_MASK_HAS_MASK, ILBM_COMPRESSION_NONE },
+	};
+
+	uint8_t file[4096];
+	uint8_t out[64 * 8];
+	for (i = 0 ; i < sizeof(tests)/sizeof(tests[0]) ; ++i) {
+		const size_t w = tests[i].width;
+		const size_t h = tests[i].height;
+		const size_t pitch = w + 3;
+		size_t flen = make_ilbm(file, w, h, tests[i].nplanes, tests[i].masking, tests[i].compression);
+
+		struct ilbm_image img;
+		if (ilbm_image_parse(file, flen, &img) != 0 || img.width != w || img.height != h || img.nplanes != tests[i].nplanes) {
+			TEST_ERRMSG("failed to parse header.");
+			++fails;
+			continue;
+		}
+
+		memset(out, GUARD, sizeof(out));
+		ssize_t res = ilbm_image_decode(&img, out, (ptrdiff_t)pitch);
+		if (res != (ssize_t)img.body_len) {
+			TEST_ERRMSG("unexpected return-value, expected '%zu', got '%zd'.", img.body_len, res);
+			++fails;
+			continue;
+		}
+		for (size_t y = 0 ; y < h ; ++y) {
+			uint8_t expected[64 + 1];
+			for (size_t x = 0 ; x < w ; ++x)
+				expected[x] = (uint8_t)((x * 7 + y * 3) & ((1u << tests[i].nplanes) - 1));
+			expected[w] = GUARD;
+			if (check_buf(testname, i, out + y * pitch, expected, w + 1) != 0) {
+				++fails;
+				break;
+			}
+		}
+
+		// Decoding must stop with an error where the BODY ends early.
+		img.body_len -= 1;
+		res = ilbm_image_decode(&img, out, (ptrdiff_t)pitch);
+		if (res >= 0) {
+			TEST_ERRMSG("expected error on truncated BODY, got '%zd'.", res);
+			++fails;
+		}
+	}
+
+	struct ilbm_image img;
+	make_ilbm(file, 16, 1, 1, ILBM_MASK_NONE, ILBM_COMPRESSION_BYTERUN1);
+	memcpy(file + 8, "PBM ", 4);
+	if (ilbm_image_parse(file, sizeof(file), &img) != -1) {
+		TEST_ERRMSG("accepted bad header.");
+		++fails;
+	}
+
+	if (fails == 0) {
+		printf("Suite '%s' passed " GREEN "OK" NC "\n", testname);
+	}
+
+	return fails;
+}
+
+static size_t put_tiff(uint8_t *buf, size_t wp, int be, size_t v, size_t size) {
+	for (size_t k = 0 ; k < size ; ++k)
+		buf[wp + k] = (uint8_t)(v >> (8 * (be ? size - 1 - k : k)));
+	return wp + size;
+}
+
+static size_t put_tiff_entry(uint8_t *buf, size_t wp, int be, size_t tag, size_t type, size_t count, size_t value) {
+	wp = put_tiff(buf, wp, be, tag, 2);
+	wp = put_tiff(buf, wp, be, type, 2);
+	wp = put_tiff(buf, wp, be, count, 4);
+	// Short values are stored in the first half of the value field.
+	if (type == 3 && count == 1)
+		return put_tiff(buf, put_tiff(buf, wp, be, value, 2), be, 0, 2);
+	return put_tiff(buf, wp, be, value, 4);
+}
+
+static uint8_t tiff_sample(size_t x, size_t y, size_t c) {
+	return (uint8_t)((x / 3) * 5 + y * 11 + c * 3);
+}
+
+// Build a TIFF file of 8-bit samples, in strips of `rps` rows, or in tiles if `tw` is non-zero.
+static size_t make_tiff(uint8_t *buf, int be, size_t w, size_t h, size_t spp, size_t rps, size_t tw, size_t tl, unsigned int compression) {
+	size_t offsets[64];
+	size_t counts[64];
+	size_t n = 0;
+	uint8_t chunk[1024];
+	size_t wp = 8;
+
+	memcpy(buf, be ? "MM\0*" : "II*\0", 4);
+	size_t cw = tw ? tw : w;
+	size_t ch = tw ? tl : rps;
+	for (size_t ty = 0 ; ty < h ; ty += ch) {
+		for (size_t tx = 0 ; tx < w ; tx += cw) {
+			size_t rows = tw ? tl : (h - ty < rps ? h - ty : rps);
+			offsets[n] = wp;
+			for (size_t y = 0 ; y < rows ; ++y) {
+				size_t len = 0;
+				for (size_t x = 0 ; x < cw ; ++x)
+					for (size_t c = 0 ; c < spp ; ++c)
+						chunk[len++] = tiff_sample(tx + x, ty + y, c);
+				// Rows are packed separately.
+				if (compression == TIFF_COMPRESSION_PACKBITS) {
+					ssize_t res = packbits_compress(chunk, len, buf + wp, 1024);
+					assert(res > 0);
+					wp += (size_t)res;
+				} else {
+					memcpy(buf + wp, chunk, len);
+					wp += len;
+				}
+			}
+			counts[n] = wp - offsets[n];
+			++n;
+			assert(n < 64);
+		}
+	}
+
+	size_t offsets_ofs = wp;
+	for (size_t i = 0 ; i < n ; ++i)
+		wp = put_tiff(buf, wp, be, offsets[i], 4);
+	size_t counts_ofs = wp;
+	for (size_t i = 0 ; i < n ; ++i)
+		wp = put_tiff(buf, wp, be, counts[i], 4);
+	size_t bps_ofs = wp;
+	for (size_t i = 0 ; i < spp ; ++i)
+		wp = put_tiff(buf, wp, be, 8, 2);
+
+	put_tiff(buf, 4, be, wp, 4);
+	wp = put_tiff(buf, wp, be, tw ? 10 : 9, 2);
+	wp = put_tiff_entry(buf, wp, be, 256, 4, 1, w);
+	wp = put_tiff_entry(buf, wp, be, 257, 4, 1, h);
+	wp = put_tiff_entry(buf, wp, be, 258, 3, spp, spp > 2 ? bps_ofs : 8 | 8 << (be ? 0 : 16));
+	wp = put_tiff_entry(buf, wp, be, 259, 3, 1, compression);
+	wp = put_tiff_entry(buf, wp, be, 262, 3, 1, spp >= 3 ? 2 : 1);
+	wp = put_tiff_entry(buf, wp, be, 277, 3, 1, spp);
+	if (tw) {
+		wp = put_tiff_entry(buf, wp, be, 322, 4, 1, tw);
+		wp = put_tiff_entry(buf, wp, be, 323, 4, 1, tl);
+		wp = put_tiff_entry(buf, wp, be, 324, 4, n, n > 1 ? offsets_ofs : offsets[0]);
+		wp = put_tiff_entry(buf, wp, be, 325, 4, n, n > 1 ? counts_ofs : counts[0]);
+	} else {
+		wp = put_tiff_entry(buf, wp, be, 273, 4, n, n > 1 ? offsets_ofs : offsets[0]);
+		wp = put_tiff_entry(buf, wp, be, 278, 4, 1, rps);
+		wp = put_tiff_entry(buf, wp, be, 279, 4, n, n > 1 ? counts_ofs : counts[0]);
+	}
+	return put_tiff(buf, wp, be, 0, 4);
+}
+
+static int test_tiff_image(void) {
+	const char *testname = "tiff_image_decode";
+	size_t fails = 0;
+	size_t i = 0;
+
+	const struct {
+		int be;
+		size_t width;
+		size_t height;
+		size_t spp;
+		size_t rps;
+		size_t tw;
+		size_t tl;
+		unsigned int compression;
+		size_t extra_pitch;
+	} tests[] = {
+		{ 0, 37, 10, 1, 3, 0, 0, TIFF_COMPRESSION_PACKBITS, 0 },
+		{ 1, 37, 10, 3, 3, 0, 0, TIFF_COMPRESSION_PACKBITS, 5 },
+		{ 0, 20, 9, 3, 100, 0, 0, TIFF_COMPRESSION_PACKBITS, 1 },
+		{ 1, 40, 35, 1, 0, 16, 16, TIFF_COMPRESSION_PACKBITS, 3 },
+		{ 0, 20, 18, 4, 0, 16, 16, TIFF_COMPRESSION_PACKBITS, 0 },
+		{ 0, 21, 7, 3, 2, 0, 0, TIFF_COMPRESSION_NONE, 2 },
+	};
+
+	uint8_t *file = malloc(65536);
+	uint8_t *out = malloc(65536);
+	assert(file && out);
+	for (i = 0 ; i < sizeof(tests)/sizeof(tests[0]) ; ++i) {
+		const size_t w = tests[i].width;
+		const size_t h = tests[i].height;
+		const size_t spp = tests[i].spp;
+		size_t flen = make_tiff(file, tests[i].be, w, h, spp, tests[i].rps, tests[i].tw, tests[i].tl, tests[i].compression);
+
+		struct tiff_image img;
+		if (tiff_image_parse(file, flen, &img) != 0 || img.width != w || img.height != h || img.samples_per_pixel != spp) {
+			TEST_ERRMSG("failed to parse header.");
+			++fails;
+			continue;
+		}
+		const size_t rowlen = tiff_image_rowlen(&img);
+		const size_t pitch = rowlen + tests[i].extra_pitch;
+
+		memset(out, GUARD, 65536);
+		ssize_t res = tiff_image_decode(&img, file, flen, out, (ptrdiff_t)pitch);
+		if (res != (ssize_t)img.nchunks) {
+			TEST_ERRMSG("unexpected return-value, expected '%zu', got '%zd'.", img.nchunks, res);
+			++fails;
+			continue;
+		}
+		for (size_t y = 0 ; y < h ; ++y) {
+			uint8_t expected[256];
+			for (size_t x = 0 ; x < w ; ++x)
+				for (size_t c = 0 ; c < spp ; ++c)
+					expected[x * spp + c] = tiff_sample(x, y, c);
+			expected[rowlen] = GUARD;
+			if (check_buf(testname, i, out + y * pitch, expected, rowlen + (tests[i].extra_pitch ? 1 : 0)) != 0) {
+				++fails;
+				break;
+			}
+		}
+		if (out[h * pitch] != GUARD) {
+			TEST_ERRMSG("write past the end of the image.");
+			++fails;
+		}
+
+		// Cutting the file short must make a strip or tile fail.
+		size_t last = tiff_array_get(img.big_endian, img.offsets, img.offsets_type, img.nchunks - 1);
+		res = tiff_image_decode(&img, file, last + 1, out, (ptrdiff_t)pitch);
+		if (res >= 0) {
+			TEST_ERRMSG("expected error on truncated file, got '%zd'.", res);
+			++fails;
+		}
+	}
+
+	struct tiff_image img;
+	if (tiff_image_parse((const uint8_t*)"II+\0\0\0\0\0", 8, &img) != -1) {
+		TEST_ERRMSG("accepted bad header.");
+		++fails;
+	}
+
+	// Hostile tile headers, patched into the IFD of a good file; entries 0 and 1 are the image size,
+	// 6 and 7 the tile size, and 8 the tile offsets.
+	const struct {
+		size_t width;
+		size_t height;
+		size_t tw;
+		size_t tl;
+		size_t first_offset;
+	} bad_tiles[] = {
+		{ 1, 2, 1UL << 30, 1UL << 31, 8 },	// Tile size overflows.
+		{ 32, 32, 24, 16, 8 },	// Not a multiple of 16.
+		{ 32, 32, 16, 2048, 8 },	// Far larger than the image.
+		{ 65536, 65536, 16384, 16384, 8 },	// Over the cap.
+		{ 32, 32, 16, 16, 0 },	// Inside the header.
+	};
+	for (size_t j = 0 ; j < sizeof(bad_tiles)/sizeof(bad_tiles[0]) ; ++j) {
+		size_t flen = make_tiff(file, 0, 32, 32, 1, 0, 16, 16, TIFF_COMPRESSION_NONE);
+		size_t ifd = tiff_array_get(0, file + 4, 4, 0) + 2;
+		put_tiff(file, ifd + 0 * 12 + 8, 0, bad_tiles[j].width, 4);
+		put_tiff(file, ifd + 1 * 12 + 8, 0, bad_tiles[j].height, 4);
+		put_tiff(file, ifd + 6 * 12 + 8, 0, bad_tiles[j].tw, 4);
+		put_tiff(file, ifd + 7 * 12 + 8, 0, bad_tiles[j].tl, 4);
+		put_tiff(file, tiff_array_get(0, file + ifd + 8 * 12 + 8, 4, 0), 0, bad_tiles[j].first_offset, 4);
+		if (tiff_image_parse(file, flen, &img) != -1) {
+			TEST_ERRMSG("accepted bad tile header %zu.", j);
+			++fails;
+		}
+	}
+
+	free(out);
+	free(file);
+
+	if (fails == 0) {
+		printf("Suite '%s' passed " GREEN "OK" NC "\n", testname);
+	}
+
+	return fails;
+}
+
+static int test_goldbox_dax(void) {
+	const char *testname = "dax_extract_all";
+	size_t fails = 0;
+	size_t i = 0;
+
+	enum { NUM = 40 };
+	struct dax_record records[NUM];
+	uint8_t *raw[NUM];
+	uint8_t *out[NUM];
+	ssize_t results[NUM];
+	for (i = 0 ; i < NUM ; ++i) {
+		size_t len = (i * 397) % 3000;
+		raw[i] = malloc(len + 1);
+		out[i] = malloc(len + 1);
+		assert(raw[i] && out[i]);
+		for (size_t k = 0 ; k < len ; ++k)
+			raw[i][k] = (uint8_t)((k / (i % 7 + 1)) * i);
+		records[i].id = (unsigned int)(200 - i);
+		records[i].data = raw[i];
+		records[i].raw_size = len;
+	}
+
+	i = 0;
+	ssize_t len = dax_build(records, NUM, NULL, 0);
+	uint8_t *archive = malloc((size_t)len);
+	assert(archive);
+	if (len <= 0 || dax_build(records, NUM, archive, (size_t)len) != len) {
+		TEST_ERRMSG("failed to build archive.");
+		++fails;
+	}
+
+	// Each record must be compressed as goldbox_compress() does on its own.
+	struct dax_archive dax;
+	if (dax_parse(&dax, archive, (size_t)len) != 0 || dax.nrecords != NUM) {
+		TEST_ERRMSG("failed to parse archive.");
+		++fails;
+	} else {
+		uint8_t tmp[8192];
+		for (i = 0 ; i < NUM ; ++i) {
+			ssize_t res = goldbox_compress(raw[i], records[i].raw_size, tmp, sizeof(tmp));
+			if (res != (ssize_t)dax.records[i].comp_size || memcmp(tmp, dax.records[i].data, (size_t)res) != 0) {
+				TEST_ERRMSG("record compressed differently.");
+				++fails;
+			}
+		}
+		i = 0;
+		if (dax_find(&dax, 190) != 10 || dax_find(&dax, 201) != -1) {
+			TEST_ERRMSG("dax_find failed.");
+			++fails;
+		}
+		dax_close(&dax);
+	}
+
+	// Extract everything from the archive on disk.
+	char filename[] = "/tmp/rle-zoo-dax-XXXXXX";
+	int fd = mkstemp(filename);
+	FILE *f = fd >= 0 ? fdopen(fd, "wb") : NULL;
+	if (!f || fwrite(archive, 1, (size_t)len, f) != (size_t)len) {
+		TEST_ERRMSG("failed to write archive.");
+		++fails;
+	}
+	if (f)
+		fclose(f);
+
+	if (dax_open(&dax, filename) != 0) {
+		TEST_ERRMSG("failed to open archive.");
+		++fails;
+	} else {
+		size_t failed = dax_extract_all(&dax, out, results);
+		if (failed != 0) {
+			TEST_ERRMSG("%zu records failed to extract.", failed);
+			++fails;
+		}
+		for (i = 0 ; i < NUM ; ++i) {
+			if (results[i] != (ssize_t)records[i].raw_size || memcmp(out[i], raw[i], records[i].raw_size) != 0) {
+				TEST_ERRMSG("record mismatch.");
+				++fails;
+			}
+		}
+		i = 0;
+		if (dax_extract(&dax, 0, out[0], 0) >= 0 && records[0].raw_size > 0) {
+			TEST_ERRMSG("accepted short output buffer.");
+			++fails;
+		}
+		dax_close(&dax);
+	}
+	remove(filename);
+
+	// Corrupt the index, so a record points outside the archive.
+	archive[2 + 9 + 7] = 0xFF;
+	archive[2 + 9 + 8] = 0xFF;
+	if (dax_parse(&dax, archive, (size_t)len) != -1) {
+		TEST_ERRMSG("accepted bad index.");
+		++fails;
+	}
+
+	free(archive);
+	for (i = 0 ; i < NUM ; ++i) {
+		free(raw[i]);
+		free(out[i]);
+	}
+
+	if (fails == 0) {
+		printf("Suite '%s' passed " GREEN "OK" NC "\n", testname);
+	}
+
+	return fails;
+}
+
+static uint8_t psd_sample(size_t x, size_t y, size_t c) {
+	return (uint8_t)((x / 4) * 9 + y * 5 + c * 70);
+}
+
+// Build a PSD (version 1) or PSB (version 2) file of 8-bit channels.
+static size_t make_psd(uint8_t *buf, unsigned int version, unsigned int mode, size_t nchannels, size_t w, size_t h, unsigned int compression) {
+	size_t wp = 0;
+	memcpy(buf, "8BPS", 4);
+	buf[4] = 0;
+	buf[5] = (uint8_t)version;
+	memset(buf + 6, 0, 6);
+	buf[12] = 0;
+	buf[13] = (uint8_t)nchannels;
+	put_be32(buf, 14, h);
+	put_be32(buf, 18, w);
+	buf[22] = 0;
+	buf[23] = 8;
+	buf[24] = 0;
+	buf[25] = (uint8_t)mode;
+	wp = 26;
+	// Color mode data, image resources with some content to skip, then layer and mask information.
+	wp = put_be32(buf, wp, 0);
+	wp = put_be32(buf, wp, 5);
+	memcpy(buf + wp, "8BIM!", 5);
+	wp += 5;
+	if (version == 2)
+		wp = put_be32(buf, wp, 0);
+	wp = put_be32(buf, wp, 0);
+	buf[wp++] = 0;
+	buf[wp++] = (uint8_t)compression;
+
+	size_t countsize = version == 2 ? 4 : 2;
+	size_t counts = wp;
+	if (compression == 1)
+		wp += nchannels * h * countsize;
+	uint8_t row[256];
+	for (size_t c = 0 ; c < nchannels ; ++c) {
+		for (size_t y = 0 ; y < h ; ++y) {
+			for (size_t x = 0 ; x < w ; ++x)
+				row[x] = psd_sample(x, y, c);
+			if (compression == 1) {
+				ssize_t res = packbits_compress(row, w, buf + wp, 1024);
+				assert(res > 0);
+				wp += (size_t)res;
+				size_t r = counts + (c * h + y) * countsize;
+				if (countsize == 4) {
+					put_be32(buf, r, (size_t)res);
+				} else {
+					buf[r] = (uint8_t)(res >> 8);
+					buf[r + 1] = (uint8_t)res;
+				}
+			} else {
+				memcpy(buf + wp, row, w);
+				wp += w;
+			}
+		}
+	}
+	return wp;
+}
+
+static int test_psd_image(void) {
+	const char *testname = "psd_image_decode";
+	size_t fails = 0;
+	size_t i = 0;
+
+	const struct {
+		unsigned int version;
+		unsigned int mode;
+		size_t nchannels;
+		size_t width;
+		size_t height;
+		unsigned int compression;
+		enum psd_format fmt;
+	} tests[] = {
+		{ 1, PSD_MODE_RGB, 3, 37, 9, 1, PSD_FORMAT_RGBA },
+		{ 1, PSD_MODE_RGB, 4, 40, 11, 1, PSD_FORMAT_RGBA },
+		{ 1, PSD_MODE_RGB, 5, 17, 8, 1, PSD_FORMAT_RGBA },
+		{ 1, PSD_MODE_CMYK, 4, 33, 10, 1, PSD_FORMAT_CMYK },
+		{ 2, PSD_MODE_RGB, 4, 64, 12, 1, PSD_FORMAT_RGBA },
+		{ 1, PSD_MODE_CMYK, 5, 20, 6, 0, PSD_FORMAT_CMYK },
+	};
+
+	uint8_t *file = malloc(65536);
+	uint8_t *out = malloc(65536);
+	assert(file && out);
+	for (i = 0 ; i < sizeof(tests)/sizeof(tests[0]) ; ++i) {
+		const size_t w = tests[i].width;
+		const size_t h = tests[i].height;
+		const size_t nchannels = tests[i].nchannels;
+		size_t flen = make_psd(file, tests[i].version, tests[i].mode, nchannels, w, h, tests[i].compression);
+
+		struct psd_image img;
+		if (psd_image_parse(file, flen, &img) != 0 || img.width != w || img.height != h || img.nchannels != nchannels) {
+			TEST_ERRMSG("failed to parse header.");
+			++fails;
+			continue;
+		}
+		const size_t rowlen = psd_image_rowlen(&img, tests[i].fmt);
+		const size_t pitch = rowlen + 4 * (i & 1);
+		if (rowlen != 4 * w || psd_image_rowlen(&img, tests[i].fmt == PSD_FORMAT_RGBA ? PSD_FORMAT_CMYK : PSD_FORMAT_RGBA) != 0) {
+			TEST_ERRMSG("unexpected row length %zu.", rowlen);
+			++fails;
+			continue;
+		}
+
+		memset(out, GUARD, 65536);
+		ssize_t res = psd_image_decode(&img, file, flen, tests[i].fmt, out, (ptrdiff_t)pitch);
+		if (res != (ssize_t)flen) {
+			TEST_ERRMSG("unexpected return-value, expected '%zu', got '%zd'.", flen, res);
+			++fails;
+			continue;
+		}
+		for (size_t y = 0 ; y < h ; ++y) {
+			uint8_t expected[4 * 64 + 1];
+			for (size_t x = 0 ; x < w ; ++x)
+				for (size_t c = 0 ; c < 4 ; ++c)
+					expected[4 * x + c] = c < nchannels ? psd_sample(x, y, c) : 0xFF;
+			expected[rowlen] = GUARD;
+			if (check_buf(testname, i, out + y * pitch, expected, rowlen + (pitch > rowlen ? 1 : 0)) != 0) {
+				++fails;
+				break;
+			}
+		}
+
+		res = psd_image_decode(&img, file, flen - 1, tests[i].fmt, out, (ptrdiff_t)pitch);
+		if (res >= 0) {
+			TEST_ERRMSG("expected error on truncated file, got '%zd'.", res);
+			++fails;
+		}
+	}
+
+	// Corrupt the first row of the second channel, so it decodes short.
+	i = 0;
+	size_t flen = make_psd(file, 1, PSD_MODE_RGB, 3, 37, 9, 1);
+	struct psd_image img;
+	psd_image_parse(file, flen, &img);
+	size_t row = img.data_ofs + 2 * 3 * 9;
+	for (size_t r = 0 ; r < 9 ; ++r)
+		row += (size_t)file[img.data_ofs + 2 * r] << 8 | file[img.data_ofs + 2 * r + 1];
+	file[row] = 0x00;
+	ssize_t res = psd_image_decode(&img, file, flen, PSD_FORMAT_RGBA, out, 4 * 37);
+	if (res != -(ssize_t)(row + 1)) {
+		TEST_ERRMSG("expected error at row, got '%zd'.", res);
+		++fails;
+	}
+
+	free(out);
+	free(file);
+
+	if (fails == 0) {
+		printf("Suite '%s' passed " GREEN "OK" NC "\n", testname);
+	}
+
+	return fails;
+}
+
+static int test_xor_frames(void) {
+	const char *testname = "decompress_xor";
+	size_t fails = 0;
+	size_t i = 0;
+
+	typedef ssize_t (*rle_fp)(const uint8_t *src, size_t slen, uint8_t *dest, size_t dlen);
+	const struct {
+		const char *name;
+		rle_fp compress;
+		rle_fp decompress_xor;
+	} codecs[] = {
+		{ "packbits", packbits_compress, packbits_decompress_xor },
+		{ "icns", icns_compress, icns_decompress_xor },
+	};
+
+	// Two frames which differ in a few places only, so the delta is mostly long zero runs.
+	enum { LEN = 3000 };
+	uint8_t prev[LEN];
+	uint8_t next[LEN];
+	uint8_t delta[LEN];
+	uint8_t packed[2 * LEN];
+	uint8_t frame[LEN + 1];
+	for (size_t k = 0 ; k < LEN ; ++k) {
+		prev[k] = (uint8_t)(k * 13 + k / 7);
+		next[k] = prev[k];
+	}
+	for (size_t k = 100 ; k < 140 ; ++k)
+		next[k] = (uint8_t)(k * 5);
+	memset(next + 1000, 0x42, 500);
+	next[LEN - 1] ^= 1;
+	for (size_t k = 0 ; k < LEN ; ++k)
+		delta[k] = prev[k] ^ next[k];
+
+	for (i = 0 ; i < sizeof(codecs)/sizeof(codecs[0]) ; ++i) {
+		ssize_t plen = codecs[i].compress(delta, LEN, packed, sizeof(packed));
+		assert(plen > 0);
+
+		memcpy(frame, prev, LEN);
+		frame[LEN] = GUARD;
+		ssize_t res = codecs[i].decompress_xor(packed, (size_t)plen, frame, LEN);
+		if (res != LEN || codecs[i].decompress_xor(packed, (size_t)plen, NULL, 0) != LEN) {
+			TEST_ERRMSG("%s: unexpected return-value, expected '%d', got '%zd'.", codecs[i].name, LEN, res);
+			++fails;
+		}
+		if (memcmp(frame, next, LEN) != 0 || frame[LEN] != GUARD) {
+			TEST_ERRMSG("%s: frame mismatch.", codecs[i].name);
+			++fails;
+		}
+		// XORing the same delta again gets back the previous frame.
+		codecs[i].decompress_xor(packed, (size_t)plen, frame, LEN);
+		if (memcmp(frame, prev, LEN) != 0) {
+			TEST_ERRMSG("%s: frame mismatch on second application.", codecs[i].name);
+			++fails;
+		}
+		if (codecs[i].decompress_xor(packed, (size_t)plen, frame, LEN - 1) >= 0) {
+			TEST_ERRMSG("%s: accepted short output buffer.", codecs[i].name);
+			++fails;
+		}
+	}
+
+	if (fails == 0) {
+		printf("Suite '%s' passed " GREEN "OK" NC "\n", testname);
+	}
+
+	return fails;
+}
+
+static int test_exepack_inplace(void) {
+	const char *testname = "exepack_decompress_inplace";
+	size_t fails = 0;
+	size_t i = 0;
+
+	// Mixed runs and copies, as in an executable with zero-filled data segments.
+	enum { LEN = 5000 };
+	uint8_t raw[LEN];
+	uint8_t buf[LEN + 1];
+	for (size_t k = 0 ; k < LEN ; ++k)
+		raw[k] = (uint8_t)(k * 7 + k / 11);
+	memset(raw + 200, 0, 1000);
+	memset(raw + 2000, 0x90, 300);
+	memset(raw + 4000, 0xFF, 900);
+
+	ssize_t plen = exepack_compress(raw, LEN, NULL, 0);
+	assert(plen > 0 && plen < LEN);
+	memset(buf, GUARD, sizeof(buf));
+	ssize_t res = exepack_compress(raw, LEN, buf, LEN);
+	assert(res == plen);
+
+	// The packed data sits at the start of the buffer, and expands to fill it.
+	res = exepack_decompress_inplace(buf, (size_t)plen, LEN);
+	if (res != LEN) {
+		TEST_ERRMSG("unexpected return-value, expected '%d', got '%zd'.", LEN, res);
+		++fails;
+	}
+	if (memcmp(buf, raw, LEN) != 0 || buf[LEN] != GUARD) {
+		TEST_ERRMSG("output mismatch.");
+		++fails;
+	}
+
+	exepack_compress(raw, LEN, buf, LEN);
+	if (exepack_decompress_inplace(buf, (size_t)plen, LEN - 1) >= 0) {
+		TEST_ERRMSG("accepted short buffer.");
+		++fails;
+	}
+
+	if (fails == 0) {
+		printf("Suite '%s' passed " GREEN "OK" NC "\n", testname);
+	}
+
+	return fails;
+}
+
+int main(void) {
+	size_t failed = 0;
+
+	failed += test_tga_image();
+	failed += test_bmp_image();
+	failed += test_pict_image();
+	failed += test_pcx_image();
+	failed += test_icns_image();
+	failed += test_ilbm_image();
+	failed += test_tiff_image();
+	failed += test_goldbox_dax();
+	failed += test_psd_image();
+	failed += test_xor_frames();
+	failed += test_exepack_inplace();
+
+	if (failed != 0) {
+		printf("Tests " RED "FAILED" NC "\n");
+	} else {
+		printf("All tests " GREEN "passed OK" NC ".\n");
+	}
+
+	return failed == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -19,6 +19,30 @@
 #include "rle_pcx.h"
 #define RLE_ZOO_ICNS_IMPLEMENTATION
 #include "rle_icns.h"
+#define RLE_ZOO_TGA_IMPLEMENTATION
+#include "rle_tga.h"
+#define RLE_ZOO_BMP_IMPLEMENTATION
+#include "rle_bmp.h"
+#define RLE_ZOO_BITRUN_IMPLEMENTATION
+#include "rle_bitrun.h"
+#define RLE_ZOO_NIBBLE_IMPLEMENTATION
+#include "rle_nibble.h"
+#define RLE_ZOO_PICT_IMPLEMENTATION
+#include "rle_pict.h"
+#define RLE_ZOO_EXEPACK_IMPLEMENTATION
+#include "rle_exepack.h"
+#define RLE_ZOO_PCX_IMAGE_IMPLEMENTATION
+#include "rle_pcx_image.h"
+#define RLE_ZOO_ICNS_IMAGE_IMPLEMENTATION
+#include "rle_icns_image.h"
+#define RLE_ZOO_ILBM_IMAGE_IMPLEMENTATION
+#include "rle_ilbm_image.h"
+#define RLE_ZOO_TIFF_IMAGE_IMPLEMENTATION
+#include "rle_tiff_image.h"
+#define RLE_ZOO_GOLDBOX_DAX_IMPLEMENTATION
+#include "rle_goldbox_dax.h"
+#define RLE_ZOO_PSD_IMAGE_IMPLEMENTATION
+#include "rle_psd_image.h"
 
 int main(void) {
 	const uint8_t input[] = "ABBCCCDDDDEEEEE";
@@ -30,6 +54,29 @@ int main(void) {
 	res += packbits_compress(input, len, NULL, 0);
 	res += pcx_compress(input, len, NULL, 0);
 	res += icns_compress(input, len, NULL, 0);
+	res += tga24_compress(input, len - 3, NULL, 0);
+	res += bmp_rle8_compress(input, len, NULL, 0);
+	res += bitrun_compress(input, len, NULL, 0);
+	res += nibble_packbits_compress(input, len, NULL, 0);
+	res += nibble_bmp_rle4_compress(input, len, NULL, 0);
+	res += pict16_compress(input, len - 1, NULL, 0);
+	res += exepack_compress(input, len, NULL, 0);
+	res += packbits_decompress_xor(input, len, NULL, 0);
+	res += icns_decompress_xor(input, len, NULL, 0);
+
+	struct pcx_image pcx;
+	res += pcx_image_parse(input, len, &pcx);
+	struct icns_icon icon;
+	res += icns_parse(input, len, &icon, 1);
+	struct ilbm_image ilbm;
+	res += ilbm_image_parse(input, len, &ilbm);
+	struct tiff_image tiff;
+	res += tiff_image_parse(input, len, &tiff);
+	struct dax_archive dax;
+	if (dax_parse(&dax, input, len) == 0)
+		dax_close(&dax);
+	struct psd_image psd;
+	res += psd_image_parse(input, len, &psd);
 
 	printf("%zd bytes required.\n", res);
 
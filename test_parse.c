@@ -9,6 +9,16 @@
 #include "utility.h"
 #define RLE_PARSE_IMPLEMENTATION
 #include "rle-parse.h"
+#define RLE_ZOO_IMPLEMENTATION
+#include "rle_goldbox.h"
+#include "rle_packbits.h"
+#include "rle_pcx.h"
+#include "rle_icns.h"
+
+#include "ops-goldbox.h"
+#include "ops-packbits.h"
+#include "ops-pcx.h"
+#include "ops-icns.h"
 
 #include <stdio.h>
 #include <stdlib.h>
@@ -243,12 +253,226 @@ static int test_parse_rle(void) {
 	return fails;
 }
 
+static int test_tbl_decompress(void) {
+	const char *testname = "rle8_tbl_decompress";
+	size_t fails = 0;
+	size_t i = 0;
+
+	typedef ssize_t (*rle_fp)(const uint8_t *src, size_t slen, uint8_t *dest, size_t dlen);
+	const struct {
+		struct rle8_tbl *tbl;
+		rle_fp compress;
+		rle_fp decompress;
+	} variants[] = {
+		{ &rle8_table_goldbox, goldbox_compress, goldbox_decompress },
+		{ &rle8_table_packbits, packbits_compress, packbits_decompress },
+		{ &rle8_table_pcx, pcx_compress, pcx_decompress },
+		{ &rle8_table_icns, icns_compress, icns_decompress },
+	};
+
+	// Short runs mixed with noise, for a mix of ops, and plain noise as an op stream.
+	enum { LEN = 4000 };
+	uint8_t raw[LEN];
+	uint8_t noise[LEN];
+	uint8_t packed[2 * LEN];
+	static uint8_t out_ref[64 * LEN];
+	static uint8_t out[64 * LEN];
+	static uint8_t out_bare[64 * LEN];
+	uint32_t x = 12345;
+	for (size_t k = 0 ; k < LEN ; ++k) {
+		x = x * 1103515245 + 12345;
+		noise[k] = (uint8_t)(x >> 16);
+		raw[k] = (x >> 28) < 6 && k > 0 ? raw[k - 1] : noise[k];
+	}
+
+	for (i = 0 ; i < sizeof(variants)/sizeof(variants[0]) ; ++i) {
+		const char *name = variants[i].tbl->name;
+		// Without a step table, the decoder must build one from the decode table, and without SIMD tables,
+		// it takes the scalar path.
+		struct rle8_tbl bare = *variants[i].tbl;
+		bare.step_tbl = NULL;
+		bare.simd_tbl = NULL;
+		ssize_t plen = variants[i].compress(raw, LEN, packed, sizeof(packed));
+		assert(plen > 0);
+
+		for (int pass = 0 ; pass < 2 ; ++pass) {
+			const uint8_t *src = pass == 0 ? packed : noise;
+			size_t slen = pass == 0 ? (size_t)plen : LEN;
+			// Truncate the input at a few points, and also the output.
+			for (size_t cut = 0 ; cut < 4 ; ++cut) {
+				size_t len = slen - cut * 7;
+				size_t dlen = cut == 3 ? LEN / 2 : sizeof(out);
+				// The table marks a few goldbox codes invalid that its hand-written decoder accepts.
+				if (pass == 1 && variants[i].tbl == &rle8_table_goldbox)
+					continue;
+				ssize_t ref = variants[i].decompress(src, len, out_ref, dlen);
+				ssize_t res = rle8_tbl_decompress(variants[i].tbl, src, len, out, dlen);
+				ssize_t size = rle8_tbl_decompress(variants[i].tbl, src, len, NULL, 0);
+				// Running out of output is reported at slightly different offsets by some of the hand-written decoders.
+				if (cut == 3 && res < 0 && ref < 0)
+					continue;
+				if (res != ref) {
+					TEST_ERRMSG("%s: pass %d, cut %zu: unexpected return-value, expected '%zd', got '%zd'.", name, pass, cut, ref, res);
+					++fails;
+				} else if (res >= 0 && memcmp(out, out_ref, (size_t)res) != 0) {
+					TEST_ERRMSG("%s: pass %d, cut %zu: output mismatch.", name, pass, cut);
+					++fails;
+				}
+				if (cut < 3 && size != ref) {
+					TEST_ERRMSG("%s: pass %d, cut %zu: unexpected size, expected '%zd', got '%zd'.", name, pass, cut, ref, size);
+					++fails;
+				}
+				ssize_t bare_res = rle8_tbl_decompress(&bare, src, len, out_bare, dlen);
+				if (bare_res != res || (res >= 0 && memcmp(out_bare, out, (size_t)res) != 0)) {
+					TEST_ERRMSG("%s: pass %d, cut %zu: decoding without a step table differs.", name, pass, cut);
+					++fails;
+				}
+			}
+		}
+	}
+
+	if (fails == 0) {
+		printf("Suite '%s' passed " GREEN "OK" NC "\n", testname);
+	}
+
+	return fails;
+}
+
+static int test_tbl_simd(void) {
+	const char *testname = "rle8_simd";
+	size_t fails = 0;
+	size_t i = 0;
+
+	struct rle8_tbl *tables[] = { &rle8_table_goldbox, &rle8_table_packbits, &rle8_table_pcx, &rle8_table_icns };
+
+	// The shuffle of every short op must give the same output as its step, and only LITs may be classified as such.
+	for (i = 0 ; i < sizeof(tables)/sizeof(tables[0]) ; ++i) {
+		const struct rle8_tbl *tbl = tables[i];
+		const struct rle8_simd *simd = tbl->simd_tbl;
+		for (int b = 0 ; b < 256 ; ++b) {
+			const struct rle8_step *s = &tbl->step_tbl[b];
+			int is_lit = (simd->lit_lo[b & 15] & simd->lit_hi[b >> 4]) != 0;
+			if (is_lit && tbl->decode_tbl[b].op != RLE_OP_LIT) {
+				TEST_ERRMSG("%s: op %02x classified as a LIT.", tbl->name, b);
+				++fails;
+			}
+			if (simd->inlen[b] == 0)
+				continue;
+			if (simd->inlen[b] != s->len || simd->outlen[b] != s->cnt) {
+				TEST_ERRMSG("%s: op %02x: lengths differ from the step table.", tbl->name, b);
+				++fails;
+			}
+			for (int k = 0 ; k < 16 ; ++k) {
+				int expected = k < s->cnt ? s->src + k * s->stride : 0x80;
+				if (simd->shuf[b][k] != expected) {
+					TEST_ERRMSG("%s: op %02x: shuffle byte %d is %02x, expected %02x.", tbl->name, b, k, simd->shuf[b][k], expected);
+					++fails;
+					break;
+				}
+			}
+		}
+	}
+	// pcx has one class of LITs, which must all be recognized.
+	for (int b = 0 ; b < 0xC0 ; ++b) {
+		if ((rle8_tbl_simd_pcx.lit_lo[b & 15] & rle8_tbl_simd_pcx.lit_hi[b >> 4]) == 0) {
+			TEST_ERRMSG("pcx: LIT %02x not classified as a LIT.", b);
+			++fails;
+		}
+	}
+
+	if (fails == 0) {
+		printf("Suite '%s' passed " GREEN "OK" NC "\n", testname);
+	}
+
+	return fails;
+}
+
+static int test_tbl_compress(void) {
+	const char *testname = "rle8_tbl_compress";
+	size_t fails = 0;
+
+	typedef ssize_t (*rle_fp)(const uint8_t *src, size_t slen, uint8_t *dest, size_t dlen);
+	const struct {
+		struct rle8_tbl *tbl;
+		rle_fp compress;
+		rle_fp decompress;
+		int exact;	// The hand-written encoder makes the same choices.
+	} variants[] = {
+		{ &rle8_table_goldbox, goldbox_compress, goldbox_decompress, 0 },
+		{ &rle8_table_packbits, packbits_compress, packbits_decompress, 1 },
+		{ &rle8_table_pcx, pcx_compress, pcx_decompress, 1 },
+		{ &rle8_table_icns, icns_compress, icns_decompress, 0 },
+	};
+
+	// Noise, short runs mixed with noise, long runs, a single byte, and a run crossing the largest CPY.
+	enum { LEN = 4000, NINPUTS = 5 };
+	static uint8_t inputs[NINPUTS][LEN];
+	const size_t lens[NINPUTS] = { LEN, LEN, LEN, 1, LEN };
+	static uint8_t packed[2 * LEN];
+	static uint8_t packed_ref[2 * LEN];
+	static uint8_t out[LEN];
+	uint32_t x = 4711;
+	for (size_t k = 0 ; k < LEN ; ++k) {
+		x = x * 1103515245 + 12345;
+		inputs[0][k] = (uint8_t)(x >> 16);
+		inputs[1][k] = (x >> 28) < 6 && k > 0 ? inputs[1][k - 1] : inputs[0][k];
+		inputs[2][k] = (uint8_t)(k / 300);
+	}
+	inputs[3][0] = 0xFF;
+	for (size_t k = 0 ; k < LEN ; ++k)
+		inputs[4][k] = (uint8_t)(k * 37);
+	memset(inputs[4] + 127, 0xAA, 3);
+
+	for (size_t i = 0 ; i < sizeof(variants)/sizeof(variants[0]) ; ++i) {
+		const char *name = variants[i].tbl->name;
+		for (size_t j = 0 ; j < NINPUTS ; ++j) {
+			const uint8_t *src = inputs[j];
+			const size_t slen = lens[j];
+			ssize_t res = rle8_tbl_compress(variants[i].tbl, src, slen, packed, sizeof(packed));
+			ssize_t size = rle8_tbl_compress(variants[i].tbl, src, slen, NULL, 0);
+			ssize_t ref = variants[i].compress(src, slen, packed_ref, sizeof(packed_ref));
+			if (res < 0 || size != res) {
+				TEST_ERRMSG("%s: input %zu: unexpected return-value '%zd', size '%zd'.", name, j, res, size);
+				++fails;
+				continue;
+			}
+			ssize_t dres = variants[i].decompress(packed, (size_t)res, out, sizeof(out));
+			if (dres != (ssize_t)slen || memcmp(out, src, slen) != 0) {
+				TEST_ERRMSG("%s: input %zu: roundtrip through the hand-written decoder failed.", name, j);
+				++fails;
+			}
+			// The goldbox encoder differs at the end of the input, and the icns encoder where a run crosses
+			// the largest CPY, which it doesn't end the CPY for.
+			if (variants[i].exact && (res != ref || memcmp(packed, packed_ref, (size_t)res) != 0)) {
+				TEST_ERRMSG("%s: input %zu: output differs from the hand-written encoder.", name, j);
+				++fails;
+			} else if (ref < 0 || (size_t)res > (size_t)ref + 2) {
+				TEST_ERRMSG("%s: input %zu: output of '%zd' bytes is larger than expected '%zd'.", name, j, res, ref);
+				++fails;
+			}
+			if (res > 1 && rle8_tbl_compress(variants[i].tbl, src, slen, packed, (size_t)res - 1) >= 0) {
+				TEST_ERRMSG("%s: input %zu: expected output overflow to fail.", name, j);
+				++fails;
+			}
+		}
+	}
+
+	if (fails == 0) {
+		printf("Suite '%s' passed " GREEN "OK" NC "\n", testname);
+	}
+
+	return fails;
+}
+
 int main(void) {
 	size_t failed = 0;
 
 	failed += test_rep();
 	failed += test_cpy();
 	failed += test_parse_rle();
+	failed += test_tbl_decompress();
+	failed += test_tbl_simd();
+	failed += test_tbl_compress();
 
 	if (failed != 0) {
 		printf("Tests " RED "FAILED" NC "\n");
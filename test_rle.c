@@ -14,6 +14,17 @@
 #include "rle_packbits.h"
 #include "rle_pcx.h"
 #include "rle_icns.h"
+#include "rle_tga.h"
+#include "rle_bmp.h"
+#include "rle_bitrun.h"
+#include "rle_nibble.h"
+#include "rle_pict.h"
+#include "rle_exepack.h"
+// Codecs generated by rle-genops, held to the same tests as the hand-written ones.
+#include "codec-goldbox.h"
+#include "codec-packbits.h"
+#include "codec-pcx.h"
+#include "codec-icns.h"
 
 #include "rle-variant-selection.h"
 
@@ -26,6 +37,38 @@
 #include <ctype.h>
 #include <sys/mman.h>
 
+static struct rle_t gen_variants[] = {
+	{
+		.name = "goldbox",
+		.compress = goldbox_gen_compress,
+		.decompress = goldbox_gen_decompress
+	},
+	{
+		.name = "packbits",
+		.compress = packbits_gen_compress,
+		.decompress = packbits_gen_decompress
+	},
+	{
+		.name = "pcx",
+		.compress = pcx_gen_compress,
+		.decompress = pcx_gen_decompress
+	},
+	{
+		.name = "icns",
+		.compress = icns_gen_compress,
+		.decompress = icns_gen_decompress
+	},
+};
+
+static struct rle_t* get_gen_rle_by_name(const char *name) {
+	for (size_t i = 0 ; i < sizeof(gen_variants)/sizeof(gen_variants[0]) ; ++i) {
+		if (strcmp(name, gen_variants[i].name) == 0) {
+			return &gen_variants[i];
+		}
+	}
+	return NULL;
+}
+
 #define RED "\e[1;31m"
 #define GREEN "\e[0;32m"
 #define YELLOW "\e[1;33m"
@@ -389,6 +432,11 @@ static int process_file(const char *filename, int depth) {
 				if (run_rle_test(rle, &te, filename, line_no) != 0) {
 					++failed_tests;
 				}
+				struct rle_t *gen = get_gen_rle_by_name(method);
+				if (gen && run_rle_test(gen, &te, filename, line_no) != 0) {
+					TEST_ERRMSG("generated codec failed.");
+					++failed_tests;
+				}
 			} else {
 				TEST_WARNMSG("unknown method '%s'", method);
 			}